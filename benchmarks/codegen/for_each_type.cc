@@ -0,0 +1,82 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Runtime type list visitor codegen, must match hand written calls
+ * @file codegen/for_each_type.cc
+ * @author Boris Vinogradov
+ */
+
+#include <lp/type_list.hh>
+#include <lp/type_list_traits.hh>
+
+template <int N>
+struct peripheral {
+    static constexpr int id = N;
+};
+
+void init(int id);
+
+bool ready(int id);
+
+using peripherals = lp::type_list<peripheral<3>, peripheral<1>,
+    peripheral<4>, peripheral<1>, peripheral<5>>;
+
+struct init_functor {
+    template <typename T>
+    void operator () (lp::tag<T>) const {
+        init(T::id);
+    }
+};
+
+struct ready_functor {
+    template <typename T>
+    bool operator () (lp::tag<T>) const {
+        return ready(T::id);
+    }
+};
+
+extern "C" void codegen_for_each_type_lp() {
+    lp::for_each_type<peripherals>(init_functor{});
+}
+
+extern "C" void codegen_for_each_type_hand() {
+    init(3);
+    init(1);
+    init(4);
+    init(1);
+    init(5);
+}
+
+extern "C" void codegen_for_each_type_lambda_lp() {
+    lp::for_each_type<peripherals>([](auto t) {
+        init(decltype(t)::type::id);
+    });
+}
+
+extern "C" void codegen_for_each_type_lambda_hand() {
+    init(3);
+    init(1);
+    init(4);
+    init(1);
+    init(5);
+}
+
+extern "C" bool codegen_for_each_type_while_lp() {
+    return lp::for_each_type_while<peripherals>(ready_functor{});
+}
+
+extern "C" bool codegen_for_each_type_while_hand() {
+    return ready(3) && ready(1) && ready(4) && ready(1) && ready(5);
+}
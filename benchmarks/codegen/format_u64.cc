@@ -0,0 +1,40 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Decimal u64_t output on 32 bit target, must not call 64 bit division
+ * of runtime library
+ * @file codegen/format_u64.cc
+ * @author Boris Vinogradov
+ */
+
+// codegen flags: -m32
+// codegen forbid: __udivdi3 __umoddi3 __divdi3 __moddi3
+
+#include <lp/types.hh>
+#include <out.hh>
+
+struct block_outer {
+    static void send(lp::i8_t symbol);
+
+    static void send(const lp::i8_t *data, lp::word_t size);
+};
+
+extern "C" lp::i8_t *codegen_dec_u64(lp::i8_t *end, lp::u64_t number) {
+    return lp::internal::number_format::dec(end, number);
+}
+
+extern "C" void codegen_out_u64(lp::u64_t number, lp::i64_t signed_number) {
+    lp::out<block_outer>::send(number, ' ', signed_number);
+}
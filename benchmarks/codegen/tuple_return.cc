@@ -0,0 +1,39 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Small tuple return codegen, must be returned in registers as struct
+ * @file codegen/tuple_return.cc
+ * @author Boris Vinogradov
+ */
+
+#include <lp/types.hh>
+#include <tuple.hh>
+
+struct split {
+    lp::u32_t word;
+    lp::u16_t half;
+    lp::u8_t byte;
+};
+
+extern "C" std::tuple<lp::u32_t, lp::u16_t, lp::u8_t>
+codegen_tuple_return_lp(lp::u32_t value) {
+    return std::make_tuple(value, static_cast<lp::u16_t>(value >> 8),
+        static_cast<lp::u8_t>(value));
+}
+
+extern "C" split codegen_tuple_return_hand(lp::u32_t value) {
+    return split{value, static_cast<lp::u16_t>(value >> 8),
+        static_cast<lp::u8_t>(value)};
+}
@@ -0,0 +1,79 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Tuple apply and element visitors codegen, must match hand written calls
+ * @file codegen/tuple_visit.cc
+ * @author Boris Vinogradov
+ */
+
+#include <tuple.hh>
+#include <lp/tuple_traits.hh>
+
+void write(int reg, int value);
+
+int read(int reg);
+
+struct write_functor {
+    void operator () (int reg, int a, int b) const {
+        write(reg, a + b);
+    }
+};
+
+struct read_functor {
+    int operator () (int reg) const {
+        return read(reg);
+    }
+};
+
+struct sum_functor {
+    int operator () (int total, int value) const {
+        return total + value;
+    }
+};
+
+extern "C" void codegen_apply_lp(int reg, int a, int b) {
+    std::apply(write_functor{}, std::make_tuple(reg, a, b));
+}
+
+extern "C" void codegen_apply_hand(int reg, int a, int b) {
+    write(reg, a + b);
+}
+
+extern "C" void codegen_for_each_lp() {
+    lp::tuple_for_each(std::make_tuple(1, 2, 3, 4), [](int reg) {
+        write(reg, 0);
+    });
+}
+
+extern "C" void codegen_for_each_hand() {
+    write(1, 0);
+    write(2, 0);
+    write(3, 0);
+    write(4, 0);
+}
+
+extern "C" int codegen_transform_fold_lp() {
+    return lp::tuple_fold(lp::tuple_transform(std::make_tuple(1, 2, 3, 4),
+        read_functor{}), 0, sum_functor{});
+}
+
+extern "C" int codegen_transform_fold_hand() {
+    const int r1 = read(1);
+    const int r2 = read(2);
+    const int r3 = read(3);
+    const int r4 = read(4);
+
+    return r1 + r2 + r3 + r4;
+}
@@ -0,0 +1,40 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Zip ranges codegen, must match hand written pointer loops
+ * @file codegen/zip.cc
+ * @author Boris Vinogradov
+ */
+
+#include <lp/zip.hh>
+
+constexpr int samples = 64;
+
+extern int level[samples];
+extern short gain[samples];
+
+extern "C" void codegen_zip_scale_lp() {
+    for (auto row : lp::zip(level, gain)) {
+        std::get<0>(row) *= std::get<1>(row);
+    }
+}
+
+extern "C" void codegen_zip_scale_hand() {
+    short *g = gain;
+
+    for (int *l = level; l != level + samples; ++l, ++g) {
+        *l *= *g;
+    }
+}
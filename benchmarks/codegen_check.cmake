@@ -0,0 +1,109 @@
+# Lepestrum C++ Library codegen checker
+#
+# Compiles every source to assembly and compares each function named
+# codegen_<name>_lp with codegen_<name>_hand. Library code is zero
+# overhead when both bodies are equal after local labels are normalized.
+#
+# Source can add compiler flags with "// codegen flags: <flags>" line and
+# forbid symbols in its assembly with "// codegen forbid: <symbols>" line,
+# such source needs no codegen_*_lp functions. Source is skipped with
+# warning when compiler does not take its flags.
+
+cmake_minimum_required(VERSION 3.5.0)
+
+string(REPLACE "|" ";" SOURCES "${SOURCES}")
+separate_arguments(FLAGS UNIX_COMMAND "${FLAGS}")
+
+# Instructions of function body without directives and labels
+function(codegen_body lines name out)
+    set(body)
+    set(inside FALSE)
+    foreach(line ${lines})
+        if(line MATCHES "^${name}:")
+            set(inside TRUE)
+        elseif(inside)
+            if(line MATCHES "^[ \t]*\\.size[ \t]+${name}," OR
+                line MATCHES "^[A-Za-z_][A-Za-z0-9_]*:")
+                break()
+            endif()
+            string(STRIP "${line}" line)
+            if(line STREQUAL "" OR line MATCHES "^\\." OR
+                line MATCHES "^[#@;/]")
+                continue()
+            endif()
+            string(REGEX REPLACE "\\.L[A-Za-z0-9_]+" ".L" line "${line}")
+            string(REGEX REPLACE "[ \t]+" " " line "${line}")
+            list(APPEND body "${line}")
+        endif()
+    endforeach()
+    set(${out} "${body}" PARENT_SCOPE)
+endfunction()
+
+set(FAILED)
+
+foreach(SOURCE ${SOURCES})
+    get_filename_component(NAME ${SOURCE} NAME_WE)
+    set(ASM ${NAME}.s)
+
+    file(STRINGS ${SOURCE} SOURCE_FLAGS REGEX "^// codegen flags:")
+    string(REGEX REPLACE "^// codegen flags:" "" SOURCE_FLAGS
+        "${SOURCE_FLAGS}")
+    separate_arguments(SOURCE_FLAGS UNIX_COMMAND "${SOURCE_FLAGS}")
+
+    file(STRINGS ${SOURCE} FORBID REGEX "^// codegen forbid:")
+    string(REGEX REPLACE "^// codegen forbid:" "" FORBID "${FORBID}")
+    separate_arguments(FORBID UNIX_COMMAND "${FORBID}")
+
+    execute_process(COMMAND ${COMPILER} -std=c++14 ${FLAGS} ${SOURCE_FLAGS}
+        -I${INCLUDE_DIR} -S ${SOURCE} -o ${ASM}
+        RESULT_VARIABLE RESULT
+        ERROR_VARIABLE REPORT)
+    if(NOT RESULT EQUAL 0 AND SOURCE_FLAGS)
+        message(WARNING "Codegen ${NAME} skipped, compiler does not take "
+            "${SOURCE_FLAGS}:\n${REPORT}")
+        continue()
+    elseif(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "Codegen ${NAME} failed to compile:\n${REPORT}")
+    endif()
+
+    file(STRINGS ${ASM} LINES)
+    string(REGEX MATCHALL "codegen_[A-Za-z0-9_]+_lp:" CASES "${LINES}")
+
+    foreach(SYMBOL ${FORBID})
+        string(REGEX MATCH "[^A-Za-z0-9_]${SYMBOL}([^A-Za-z0-9_]|$)" FOUND
+            "${LINES}")
+        if(FOUND)
+            list(APPEND FAILED "${NAME}: ${SYMBOL} is used")
+        else()
+            message(STATUS "${NAME}: no ${SYMBOL}")
+        endif()
+    endforeach()
+
+    if(NOT CASES AND NOT FORBID)
+        message(FATAL_ERROR "Codegen ${NAME} has no codegen_*_lp functions")
+    endif()
+
+    foreach(CASE ${CASES})
+        string(REGEX REPLACE "_lp:$" "" CASE ${CASE})
+        codegen_body("${LINES}" ${CASE}_lp LP_BODY)
+        codegen_body("${LINES}" ${CASE}_hand HAND_BODY)
+        list(LENGTH LP_BODY LP_SIZE)
+
+        if(NOT HAND_BODY)
+            list(APPEND FAILED "${NAME}/${CASE}: no hand written function")
+        elseif(NOT LP_BODY STREQUAL HAND_BODY)
+            string(REPLACE ";" "\n    " LP_BODY "${LP_BODY}")
+            string(REPLACE ";" "\n    " HAND_BODY "${HAND_BODY}")
+            message(STATUS "${NAME}/${CASE} lp:\n    ${LP_BODY}")
+            message(STATUS "${NAME}/${CASE} hand:\n    ${HAND_BODY}")
+            list(APPEND FAILED "${NAME}/${CASE}: code differs")
+        else()
+            message(STATUS "${NAME}/${CASE}: ${LP_SIZE} instructions, equal")
+        endif()
+    endforeach()
+endforeach()
+
+if(FAILED)
+    string(REPLACE ";" "\n  " FAILED "${FAILED}")
+    message(FATAL_ERROR "Codegen checks failed:\n  ${FAILED}")
+endif()
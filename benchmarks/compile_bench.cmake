@@ -0,0 +1,180 @@
+# Lepestrum C++ Library compile benchmark runner
+#
+# Compiles every generated source, records wall time, peak memory,
+# template instantiation statistics and object size to CSV and compares
+# result against optional baseline CSV.
+#
+# Peak memory is taken from GNU time when it is available, otherwise from
+# GCC -ftime-report total memory. Instantiation count is taken from Clang
+# -ftime-trace, GCC reports only template instantiation time.
+
+cmake_minimum_required(VERSION 3.5.0)
+
+string(REPLACE "|" ";" SOURCES "${SOURCES}")
+separate_arguments(FLAGS UNIX_COMMAND "${FLAGS}")
+
+if(NOT REPEAT)
+    set(REPEAT 1)
+endif()
+
+find_program(TIME_EXECUTABLE NAMES time PATHS /usr/bin NO_DEFAULT_PATH)
+
+# Current time in microseconds, second resolution on old CMake
+function(bench_now out)
+    if(CMAKE_VERSION VERSION_LESS 3.23)
+        string(TIMESTAMP now "%s")
+        set(now "${now}000000")
+    else()
+        string(TIMESTAMP now "%s%f")
+    endif()
+    set(${out} ${now} PARENT_SCOPE)
+endfunction()
+
+# Convert GCC memory report (123k, 12M) to kilobytes
+function(bench_to_kb value out)
+    string(REGEX MATCH "([0-9]+)([kMG]?)" match "${value}")
+    set(kb ${CMAKE_MATCH_1})
+    if(CMAKE_MATCH_2 STREQUAL "M")
+        math(EXPR kb "${kb} * 1024")
+    elseif(CMAKE_MATCH_2 STREQUAL "G")
+        math(EXPR kb "${kb} * 1024 * 1024")
+    endif()
+    set(${out} ${kb} PARENT_SCOPE)
+endfunction()
+
+set(REPORT_FLAGS)
+if(COMPILER_ID STREQUAL "GNU")
+    set(REPORT_FLAGS -ftime-report)
+elseif(COMPILER_ID MATCHES "Clang")
+    set(REPORT_FLAGS -ftime-trace -ftime-trace-granularity=0)
+endif()
+
+set(ROWS "case,size,wall_ms,peak_kb,instantiations,inst_ms,object_bytes")
+
+foreach(SOURCE ${SOURCES})
+    get_filename_component(NAME ${SOURCE} NAME_WE)
+    string(REGEX MATCH "^(.*)_([0-9]+)$" match ${NAME})
+    set(CASE ${CMAKE_MATCH_1})
+    set(SIZE ${CMAKE_MATCH_2})
+    set(OBJECT ${NAME}.o)
+
+    set(COMMAND ${COMPILER} -std=c++14 ${FLAGS} ${REPORT_FLAGS}
+        -I${INCLUDE_DIR} -c ${SOURCE} -o ${OBJECT})
+    if(TIME_EXECUTABLE)
+        set(COMMAND ${TIME_EXECUTABLE} -f "%M" -o ${NAME}.mem ${COMMAND})
+    endif()
+
+    set(WALL "")
+    foreach(RUN RANGE 1 ${REPEAT})
+        bench_now(START)
+        execute_process(COMMAND ${COMMAND}
+            RESULT_VARIABLE RESULT
+            ERROR_VARIABLE REPORT
+            OUTPUT_QUIET)
+        bench_now(STOP)
+
+        if(NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "Benchmark ${NAME} failed to compile:\n"
+                "${REPORT}")
+        endif()
+
+        math(EXPR RUN_WALL "(${STOP} - ${START}) / 1000")
+        if(WALL STREQUAL "" OR RUN_WALL LESS WALL)
+            set(WALL ${RUN_WALL})
+        endif()
+    endforeach()
+
+    set(PEAK "")
+    set(INSTANTIATIONS "")
+    set(INST_TIME "")
+
+    if(TIME_EXECUTABLE)
+        file(STRINGS ${NAME}.mem PEAK REGEX "^[0-9]+$")
+    endif()
+
+    if(COMPILER_ID STREQUAL "GNU")
+        string(REGEX MATCH "template instantiation *: *([0-9.]+)"
+            match "${REPORT}")
+        # user time of instantiation phase in seconds
+        string(REGEX MATCH "[0-9.]+$" INST_TIME "${match}")
+        string(REGEX MATCH "TOTAL *:[^\n]*" match "${REPORT}")
+        string(REGEX MATCH "[0-9]+[kMG]$" match "${match}")
+        if(PEAK STREQUAL "" AND match)
+            bench_to_kb(${match} PEAK)
+        endif()
+    elseif(COMPILER_ID MATCHES "Clang" AND EXISTS ${NAME}.json)
+        file(READ ${NAME}.json TRACE)
+        string(REGEX MATCHALL "\"name\":\"Instantiate(Class|Function)\""
+            match "${TRACE}")
+        list(LENGTH match INSTANTIATIONS)
+    endif()
+
+    if(INST_TIME MATCHES "^[0-9]+\\.[0-9]+$")
+        string(REGEX REPLACE "^([0-9]+)\\.([0-9][0-9]).*$" "\\1\\2"
+            INST_TIME ${INST_TIME})
+        math(EXPR INST_TIME "${INST_TIME} * 10")
+    endif()
+
+    file(SIZE ${OBJECT} OBJECT_SIZE)
+
+    set(ROW "${CASE},${SIZE},${WALL},${PEAK},${INSTANTIATIONS},${INST_TIME}")
+    set(ROW "${ROW},${OBJECT_SIZE}")
+    message(STATUS "${ROW}")
+    list(APPEND ROWS ${ROW})
+endforeach()
+
+string(REPLACE ";" "\n" CONTENT "${ROWS}")
+file(WRITE ${CSV} "${CONTENT}\n")
+message(STATUS "Compile benchmark results: ${CSV}")
+
+if(NOT BASELINE)
+    return()
+endif()
+
+if(NOT EXISTS ${BASELINE})
+    message(FATAL_ERROR "Compile benchmark baseline ${BASELINE} not found")
+endif()
+
+file(STRINGS ${BASELINE} BASE_ROWS)
+list(REMOVE_AT BASE_ROWS 0)
+
+set(REGRESSIONS)
+foreach(BASE_ROW ${BASE_ROWS})
+    string(REPLACE "," ";" BASE "${BASE_ROW}")
+    list(GET BASE 0 BASE_CASE)
+    list(GET BASE 1 BASE_SIZE)
+
+    foreach(ROW ${ROWS})
+        string(REPLACE "," ";" CURRENT "${ROW}")
+        list(GET CURRENT 0 CURRENT_CASE)
+        list(GET CURRENT 1 CURRENT_SIZE)
+        if(NOT CURRENT_CASE STREQUAL BASE_CASE
+            OR NOT CURRENT_SIZE STREQUAL BASE_SIZE)
+            continue()
+        endif()
+
+        # wall_ms, peak_kb, instantiations, object_bytes
+        foreach(COLUMN 2 3 4 6)
+            list(GET BASE ${COLUMN} OLD)
+            list(GET CURRENT ${COLUMN} NEW)
+            if(OLD STREQUAL "" OR NEW STREQUAL "" OR OLD EQUAL 0)
+                continue()
+            endif()
+
+            math(EXPR LIMIT "${OLD} + ${OLD} * ${THRESHOLD} / 100")
+            if(NEW GREATER LIMIT)
+                list(GET ROWS 0 HEADER)
+                string(REPLACE "," ";" HEADER "${HEADER}")
+                list(GET HEADER ${COLUMN} METRIC)
+                list(APPEND REGRESSIONS
+                    "${BASE_CASE}/${BASE_SIZE} ${METRIC}: ${OLD} -> ${NEW}")
+            endif()
+        endforeach()
+    endforeach()
+endforeach()
+
+if(REGRESSIONS)
+    string(REPLACE ";" "\n  " REGRESSIONS "${REGRESSIONS}")
+    message(FATAL_ERROR "Compile benchmark regressions over "
+        "${THRESHOLD}%:\n  ${REGRESSIONS}")
+endif()
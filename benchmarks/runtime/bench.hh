@@ -0,0 +1,110 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Runtime benchmark harness for host builds
+ * @file runtime/bench.hh
+ * @author Boris Vinogradov
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#ifndef LP_CC_LIB_BENCH_HH
+#define LP_CC_LIB_BENCH_HH
+
+namespace bench {
+    /// Monotonic time in nanoseconds
+    inline unsigned long long now() {
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+
+        return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+    }
+
+    /// Time stamp counter ticks, nanoseconds where it is not available
+    inline unsigned long long cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __builtin_ia32_rdtsc();
+#else
+        return now();
+#endif
+    }
+
+    /// Keep value alive, compiler must assume it is used
+    template <typename T>
+    inline void keep(const T &value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /// Compiler must assume that memory is changed
+    inline void clobber() {
+        asm volatile("" : : : "memory");
+    }
+
+    /// Minimal time of five runs per operation, nanoseconds by default
+    template <typename Function>
+    inline double measure(unsigned long iterations, Function function,
+        unsigned long long (*clock)() = now) {
+        double best = 0;
+
+        for (int run = 0; run < 5; run++) {
+            const auto start = clock();
+            for (unsigned long i = 0; i < iterations; i++) {
+                function(i);
+            }
+            const double time =
+                static_cast<double>(clock() - start) / iterations;
+
+            if (run == 0 || time < best) {
+                best = time;
+            }
+        }
+
+        return best;
+    }
+
+    /// Print result line: benchmark name, nanoseconds per operation
+    template <typename Function>
+    inline double run(const char *name, unsigned long iterations,
+        Function function) {
+        const auto time = measure(iterations, function);
+        printf("%-48s %10.3f ns/op\n", name, time);
+
+        return time;
+    }
+
+    /// Print result line: benchmark name, cycles per operation
+    template <typename Function>
+    inline double run_cycles(const char *name, unsigned long iterations,
+        Function function) {
+        const auto time = measure(iterations, function, cycles);
+        printf("%-48s %10.3f cycles/op\n", name, time);
+
+        return time;
+    }
+
+    /// Pseudo random sequence, values are not known to compiler
+    struct random {
+        unsigned state;
+
+        unsigned operator () () {
+            state = state * 1664525u + 1013904223u;
+
+            return state >> 8;
+        }
+    };
+} // namespace bench
+
+#endif // LP_CC_LIB_BENCH_HH
@@ -0,0 +1,101 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Runtime index dispatch benchmark: function table against if-chain
+ * @file runtime/dispatch.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <lp/type_list.hh>
+#include <lp/type_list_traits.hh>
+
+#include <utility.hh>
+
+template <lp::word_t N>
+struct message {
+    static constexpr lp::word_t id = N;
+};
+
+template <typename Index>
+struct messages;
+
+template <lp::word_t ...Index>
+struct messages<std::index_sequence<Index...>> {
+    using type = lp::type_list<message<Index>...>;
+};
+
+template <lp::word_t N>
+using messages_t = typename messages<std::make_index_sequence<N>>::type;
+
+/// Recursive if-chain - hand written switch replacement
+template <typename List>
+struct if_chain {
+    template <typename Functor>
+    static lp::word_t apply(lp::word_t index, Functor &functor) {
+        if (index == 0) {
+            return functor(lp::tag<typename List::head>{});
+        }
+
+        return if_chain<typename List::tail>::apply(index - 1, functor);
+    }
+};
+
+template <>
+struct if_chain<lp::type_list<>> {
+    template <typename Functor>
+    static lp::word_t apply(lp::word_t, Functor &) {
+        return 0;
+    }
+};
+
+struct handler {
+    template <typename T>
+    __attribute__((noinline)) lp::word_t operator () (lp::tag<T>) {
+        bench::clobber();
+
+        return T::id * 3 + 1;
+    }
+};
+
+template <lp::word_t N>
+void bench_size() {
+    using list = messages_t<N>;
+    constexpr unsigned long iterations = 10000000;
+
+    char name[64];
+    handler functor;
+    bench::random random{1};
+
+    snprintf(name, sizeof(name), "dispatch<%zu>", N);
+    bench::run(name, iterations, [&](unsigned long) {
+        bench::keep(lp::dispatch<list>(random() % N, functor));
+    });
+
+    snprintf(name, sizeof(name), "if_chain<%zu>", N);
+    bench::run(name, iterations, [&](unsigned long) {
+        bench::keep(if_chain<list>::apply(random() % N, functor));
+    });
+}
+
+int main() {
+    bench_size<4>();
+    bench_size<8>();
+    bench_size<16>();
+    bench_size<32>();
+    bench_size<64>();
+    bench_size<200>();
+}
@@ -0,0 +1,110 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Formatting to memory buffer, lp::format_to against snprintf
+ * @file runtime/format_to.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <lp/types.hh>
+
+#include <out.hh>
+
+lp::i8_t buffer[128];
+
+lp::u32_t value(unsigned long i) {
+    return static_cast<lp::u32_t>(i * 2654435761u);
+}
+
+unsigned long snprintf_line(unsigned long i) {
+    return static_cast<unsigned long>(snprintf(buffer, sizeof(buffer),
+        "sensor %u value %u status 0x%x delta %d\n",
+        static_cast<unsigned>(i % 16), static_cast<unsigned>(value(i)),
+        static_cast<unsigned>(i & 0xff),
+        static_cast<int>(value(i)) / 1000));
+}
+
+unsigned long format_to_line(unsigned long i) {
+    return lp::format_to(buffer, sizeof(buffer),
+        "sensor ", static_cast<lp::u32_t>(i % 16), " value ", value(i),
+        " status 0x", lp::make_base(lp::number_base::hex,
+            static_cast<lp::u32_t>(i & 0xff)),
+        " delta ", static_cast<lp::i32_t>(value(i)) / 1000, '\n').size;
+}
+
+unsigned long snprintf_number(unsigned long i) {
+    return static_cast<unsigned long>(snprintf(buffer, sizeof(buffer),
+        "%u", static_cast<unsigned>(value(i))));
+}
+
+unsigned long format_to_number(unsigned long i) {
+    return lp::format_to(buffer, sizeof(buffer), value(i)).size;
+}
+
+/// Both formatters give the same text
+bool same(unsigned long (*a)(unsigned long),
+    unsigned long (*b)(unsigned long)) {
+    char expected[sizeof(buffer)];
+
+    for (unsigned long i = 0; i < 100000; i++) {
+        const unsigned long size = a(i);
+        memcpy(expected, buffer, size);
+
+        if (b(i) != size || memcmp(expected, buffer, size) != 0) {
+            printf("mismatch at %lu\n", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main() {
+    constexpr unsigned long iterations = 2000000;
+
+    if (!same(snprintf_line, format_to_line) ||
+        !same(snprintf_number, format_to_number)) {
+        return 1;
+    }
+
+    bench::run_cycles("log line, snprintf", iterations,
+        [](unsigned long i) {
+            bench::keep(snprintf_line(i));
+            bench::clobber();
+        });
+
+    bench::run_cycles("log line, lp::format_to", iterations,
+        [](unsigned long i) {
+            bench::keep(format_to_line(i));
+            bench::clobber();
+        });
+
+    bench::run_cycles("u32_t, snprintf", iterations,
+        [](unsigned long i) {
+            bench::keep(snprintf_number(i));
+            bench::clobber();
+        });
+
+    bench::run_cycles("u32_t, lp::format_to", iterations,
+        [](unsigned long i) {
+            bench::keep(format_to_number(i));
+            bench::clobber();
+        });
+}
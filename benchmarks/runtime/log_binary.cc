@@ -0,0 +1,153 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Deferred binary lp::log against text lp::out, end to end decode check
+ * @file runtime/log_binary.cc
+ * @author Boris Vinogradov
+ */
+
+/// Image reads its own string table
+#define LP_CC_LIB_LOG_SECTION_FLAGS "a"
+
+#include "bench.hh"
+
+#include <lp/types.hh>
+
+#include <log.hh>
+#include <out.hh>
+
+/// String table of this image, symbols are created by linker
+extern "C" const lp::i8_t __start_lp_log[];
+extern "C" const lp::i8_t __stop_lp_log[];
+
+/// Mock serial line, bytes are kept in memory
+template <unsigned Tag>
+struct memory_outer {
+    static lp::i8_t data[1 << 20];
+    static lp::word_t size;
+
+    static void send(const lp::i8_t symbol) {
+        data[size++ & ((1 << 20) - 1)] = symbol;
+    }
+
+    __attribute__((noinline))
+    static void send(const lp::i8_t *block, lp::word_t count) {
+        while (count-- > 0) {
+            data[size++ & ((1 << 20) - 1)] = *block++;
+        }
+    }
+};
+
+template <unsigned Tag>
+lp::i8_t memory_outer<Tag>::data[1 << 20];
+
+template <unsigned Tag>
+lp::word_t memory_outer<Tag>::size = 0;
+
+using text_outer = memory_outer<0>;
+using binary_outer = memory_outer<1>;
+using decoded_outer = memory_outer<2>;
+
+struct sample {
+    lp::u32_t channel;
+    lp::u32_t value;
+    lp::u16_t status;
+    lp::i32_t delta;
+};
+
+void text_line(const sample &s) {
+    using out = lp::out<text_outer>;
+
+    out::send("sensor ", s.channel, " value ", s.value, " status 0x",
+        out::make_base(out::base::hex, s.status), " delta ", s.delta, '\n');
+}
+
+void binary_line(const sample &s) {
+    using namespace lp::literals;
+
+    lp::log<binary_outer>::send(
+        "sensor {} value {} status 0x{x} delta {}\n"_lit,
+        s.channel, s.value, s.status, s.delta);
+}
+
+sample make_sample(bench::random &random) {
+    return sample{random() % 16, random(),
+        static_cast<lp::u16_t>(random()),
+        static_cast<lp::i32_t>(random()) - (1 << 23)};
+}
+
+/// Text restored from frames is equal to text of lp::out
+bool check_decode() {
+    constexpr unsigned long lines = 10000;
+    bench::random random{1};
+
+    text_outer::size = 0;
+    binary_outer::size = 0;
+    decoded_outer::size = 0;
+
+    for (unsigned long i = 0; i < lines; i++) {
+        const sample s = make_sample(random);
+        text_line(s);
+        binary_line(s);
+    }
+
+    const lp::log_decoder<decoded_outer> decoder(__start_lp_log,
+        __stop_lp_log - __start_lp_log);
+
+    lp::word_t at = 0;
+    lp::word_t frame = 0;
+    while ((frame = decoder.decode(binary_outer::data + at,
+        binary_outer::size - at)) > 0) {
+        at += frame;
+    }
+
+    bool equal = decoder.valid() && at == binary_outer::size &&
+        decoded_outer::size == text_outer::size;
+    for (lp::word_t i = 0; equal && i < text_outer::size; i++) {
+        equal = decoded_outer::data[i] == text_outer::data[i];
+    }
+
+    printf("decode of %lu lines: %s, table %ld bytes\n", lines,
+        equal ? "equal to text" : "MISMATCH",
+        static_cast<long>(__stop_lp_log - __start_lp_log));
+    printf("%-48s %10.2f bytes/line\n", "text lp::out",
+        static_cast<double>(text_outer::size) / lines);
+    printf("%-48s %10.2f bytes/line\n", "binary lp::log",
+        static_cast<double>(binary_outer::size) / lines);
+
+    return equal;
+}
+
+int main() {
+    constexpr unsigned long iterations = 1000000;
+
+    if (!check_decode()) {
+        return 1;
+    }
+
+    bench::random random{1};
+    sample samples[256];
+    for (auto &s : samples) {
+        s = make_sample(random);
+    }
+
+    bench::run_cycles("text lp::out", iterations, [&](unsigned long i) {
+        text_line(samples[i & 255]);
+    });
+
+    bench::run_cycles("binary lp::log", iterations, [&](unsigned long i) {
+        binary_line(samples[i & 255]);
+    });
+}
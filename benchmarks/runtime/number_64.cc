@@ -0,0 +1,98 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * 64 bit number formatting and parsing throughput
+ * @file runtime/number_64.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <lp/types.hh>
+
+#include <in.hh>
+#include <out.hh>
+
+using format = lp::internal::number_format;
+using parse = lp::internal::number_parse;
+
+constexpr unsigned long count = 1024;
+
+lp::i8_t buffer[65];
+lp::i8_t texts[count][24];
+const lp::i8_t *text_begin[count];
+
+/// Runtime base, not known to compiler
+lp::u8_t base_of(lp::u8_t base) {
+    asm volatile("" : "+r"(base));
+
+    return base;
+}
+
+/// Numbers with uniformly distributed digit count up to 20 digits
+lp::u64_t number(unsigned long i) {
+    lp::u64_t n = (i * 0x9e3779b97f4a7c15ull) | 1;
+
+    for (unsigned long shift = i % 20; shift > 0; shift--) {
+        n /= 10;
+    }
+
+    return n;
+}
+
+int main() {
+    constexpr unsigned long iterations = 2000000;
+
+    for (unsigned long i = 0; i < count; i++) {
+        const auto first = format::dec(buffer + 64, number(i));
+        auto out = texts[i];
+
+        for (auto p = first; *p != '\0'; p++) {
+            *out++ = *p;
+        }
+        *out = '\0';
+        text_begin[i] = texts[i];
+    }
+
+    bench::run_cycles("format u64_t, division per digit", iterations,
+        [](unsigned long i) {
+            bench::keep(format::any(buffer + 64, number(i), base_of(10)));
+            bench::clobber();
+        });
+
+    bench::run_cycles("format u64_t, 10^9 chunks", iterations,
+        [](unsigned long i) {
+            bench::keep(format::dec(buffer + 64, number(i)));
+            bench::clobber();
+        });
+
+    bench::run_cycles("parse u64_t, multiply per digit", iterations,
+        [](unsigned long i) {
+            lp::u64_t n = 0;
+            parse::digits_scalar(text_begin[i % count],
+                text_begin[i % count] + 24, base_of(10), n);
+            bench::keep(n);
+            bench::clobber();
+        });
+
+    bench::run_cycles("parse u64_t, u32_t chunks", iterations,
+        [](unsigned long i) {
+            lp::u64_t n = 0;
+            parse::digits_chunked(text_begin[i % count],
+                text_begin[i % count] + 24, base_of(10), n);
+            bench::keep(n);
+            bench::clobber();
+        });
+}
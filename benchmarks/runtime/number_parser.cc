@@ -0,0 +1,160 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Push number parser fed by symbols and chunks against buffered convert
+ * @file runtime/number_parser.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <lp/types.hh>
+
+#include <in.hh>
+#include <out.hh>
+
+constexpr unsigned long count = 4096;
+
+/// Space separated decimal and hex numbers of stream
+lp::i8_t stream[count * 12];
+lp::word_t stream_size = 0;
+lp::word_t offsets[count + 1];
+
+lp::u32_t sum_convert() {
+    lp::u32_t sum = 0;
+
+    for (unsigned long i = 0; i < count; i++) {
+        lp::u32_t number = 0;
+        lp::internal::number_parse::convert(stream + offsets[i],
+            stream + offsets[i + 1], number);
+        sum += number;
+    }
+
+    return sum;
+}
+
+/// Receive register of UART, read by call per symbol
+struct stream_inner {
+    static lp::word_t at;
+
+    __attribute__((noinline)) static lp::i8_t recv() {
+        return at < stream_size ? stream[at++] : '\n';
+    }
+
+    static void send(lp::i8_t) {}
+};
+
+lp::word_t stream_inner::at = 0;
+
+lp::u32_t sum_recv() {
+    lp::u32_t sum = 0;
+
+    stream_inner::at = 0;
+    for (unsigned long i = 0; i < count; i++) {
+        lp::u32_t number = 0;
+        lp::in<stream_inner, false>::recv(number);
+        sum += number;
+    }
+
+    return sum;
+}
+
+lp::u32_t sum_push() {
+    lp::number_parser<lp::u32_t> parser;
+    lp::u32_t sum = 0;
+
+    for (lp::word_t i = 0; i < stream_size; i++) {
+        if (parser.push(stream[i]) !=
+            lp::number_parser<lp::u32_t>::status::more) {
+            sum += parser.value();
+            parser.reset();
+        }
+    }
+
+    return sum;
+}
+
+/// Chunks of UART FIFO or DMA half buffer
+template <lp::word_t Chunk>
+lp::u32_t sum_feed() {
+    lp::number_parser<lp::u32_t> parser;
+    lp::u32_t sum = 0;
+
+    for (lp::word_t at = 0; at < stream_size; at += Chunk) {
+        const lp::word_t size =
+            stream_size - at < Chunk ? stream_size - at : Chunk;
+
+        for (lp::word_t used = 0; used < size;) {
+            used += parser.feed(stream + at + used, size - used);
+
+            if (parser.result() !=
+                lp::number_parser<lp::u32_t>::status::more) {
+                sum += parser.value();
+                parser.reset();
+            }
+        }
+    }
+
+    return sum;
+}
+
+int main() {
+    constexpr unsigned long iterations = 1000;
+    bench::random random{7};
+
+    for (unsigned long i = 0; i < count; i++) {
+        const lp::u32_t number = random() >> (random() % 24);
+        lp::i8_t buffer[33] = {};
+        const lp::i8_t *text = i % 4 == 0 ?
+            lp::internal::number_format::pow2<4>(buffer + 32, number) :
+            lp::internal::number_format::dec(buffer + 32, number);
+
+        offsets[i] = stream_size;
+        if (i % 4 == 0) {
+            stream[stream_size++] = '0';
+            stream[stream_size++] = 'x';
+        }
+        while (*text != '\0') {
+            stream[stream_size++] = *text++;
+        }
+        stream[stream_size++] = ' ';
+    }
+    offsets[count] = stream_size;
+
+    const lp::u32_t expected = sum_convert();
+    if (sum_recv() != expected || sum_push() != expected ||
+        sum_feed<16>() != expected || sum_feed<256>() != expected) {
+        printf("number_parser: sum mismatch\n");
+        return 1;
+    }
+
+    printf("%lu numbers, %lu symbols per pass\n", count,
+        static_cast<unsigned long>(stream_size));
+
+    bench::run("convert of buffered token", iterations,
+        [](unsigned long) { bench::keep(sum_convert()); });
+
+    bench::run("blocking in::recv, inner call per symbol", iterations,
+        [](unsigned long) { bench::keep(sum_recv()); });
+
+    bench::run("number_parser, push per symbol", iterations,
+        [](unsigned long) { bench::keep(sum_push()); });
+
+    bench::run("number_parser, feed 16 symbol chunks", iterations,
+        [](unsigned long) { bench::keep(sum_feed<16>()); });
+
+    bench::run("number_parser, feed 256 symbol chunks", iterations,
+        [](unsigned long) { bench::keep(sum_feed<256>()); });
+}
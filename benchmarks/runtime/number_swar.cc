@@ -0,0 +1,162 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Eight digits per word against digit per iteration parsing, random
+ * equivalence check of both loops
+ * @file runtime/number_swar.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <lp/types.hh>
+
+#include <in.hh>
+#include <out.hh>
+
+using parse = lp::internal::number_parse;
+
+constexpr unsigned long count = 4096;
+
+/// Calibration table: decimal and hex texts of 1 - 20 digits
+lp::i8_t texts[2][count][24];
+lp::word_t sizes[2][count];
+
+/// Runtime base, not known to compiler
+lp::u8_t base_of(lp::u8_t base) {
+    asm volatile("" : "+r"(base));
+
+    return base;
+}
+
+/// Random texts of digits with rare other symbols, both loops are equal
+bool fuzz(unsigned long cases) {
+    constexpr const lp::i8_t symbols[] = "0123456789abcdefABCDEFgz\x80 ";
+    bench::random random{11};
+
+    for (unsigned long i = 0; i < cases; i++) {
+        const lp::u8_t base = i % 2 == 0 ? 10 : 16;
+        lp::i8_t text[40] = {};
+        const lp::word_t size = random() % 40;
+
+        for (lp::word_t j = 0; j < size; j++) {
+            const unsigned pick = random();
+            text[j] = pick % 64 == 0 ?
+                symbols[(pick >> 6) % (sizeof(symbols) - 1)] :
+                symbols[(pick >> 6) % base];
+        }
+
+        lp::u64_t swar = 0;
+        lp::u64_t scalar = 0;
+        parse::digits(text, text + size, base, swar);
+        parse::digits_scalar(text, text + size, base, scalar);
+
+        if (swar != scalar) {
+            printf("mismatch of base %u: '%.*s'\n", base,
+                static_cast<int>(size), text);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <bool Swar>
+lp::u64_t sum(const unsigned table, const lp::u8_t base) {
+    lp::u64_t total = 0;
+
+    for (unsigned long i = 0; i < count; i++) {
+        lp::u64_t number = 0;
+        const lp::i8_t *text = texts[table][i];
+
+        if (Swar) {
+            parse::digits(text, text + sizes[table][i], base, number);
+        } else {
+            parse::digits_scalar(text, text + sizes[table][i], base, number);
+        }
+        total += number;
+    }
+
+    return total;
+}
+
+/// Numbers of random bit width below 64 - shift
+void fill(const unsigned shift) {
+    bench::random random{3};
+    lp::word_t digits[2] = {};
+
+    for (unsigned long i = 0; i < count; i++) {
+        lp::u64_t number = (static_cast<lp::u64_t>(random()) << 40) ^
+            (static_cast<lp::u64_t>(random()) << 20) ^ random();
+        number >>= random() % shift;
+
+        lp::i8_t buffer[65] = {};
+        const lp::i8_t *texts_of[2] = {
+            lp::internal::number_format::dec(buffer + 64, number),
+            lp::internal::number_format::pow2<4>(buffer + 40, number)};
+
+        for (unsigned table = 0; table < 2; table++) {
+            lp::word_t size = 0;
+            for (auto p = texts_of[table]; *p != '\0'; p++) {
+                texts[table][i][size++] = *p;
+            }
+            sizes[table][i] = size;
+            digits[table] += size;
+        }
+    }
+
+    printf("%lu numbers, %.1f decimal and %.1f hex digits per number\n",
+        count, static_cast<double>(digits[0]) / count,
+        static_cast<double>(digits[1]) / count);
+}
+
+int main() {
+    constexpr unsigned long iterations = 500;
+
+    if (!fuzz(1000000)) {
+        return 1;
+    }
+
+    printf("1000000 random texts: word and scalar loops are equal\n");
+
+    for (const unsigned shift : {64u, 16u}) {
+        fill(shift);
+
+        if (sum<true>(0, 10) != sum<false>(0, 10) ||
+            sum<true>(1, 16) != sum<false>(1, 16)) {
+            return 1;
+        }
+
+        bench::run("decimal u64_t, digit per iteration", iterations,
+            [](unsigned long) {
+                bench::keep(sum<false>(0, base_of(10)));
+            });
+
+        bench::run("decimal u64_t, eight digits per word", iterations,
+            [](unsigned long) {
+                bench::keep(sum<true>(0, base_of(10)));
+            });
+
+        bench::run("hex u64_t, digit per iteration", iterations,
+            [](unsigned long) {
+                bench::keep(sum<false>(1, base_of(16)));
+            });
+
+        bench::run("hex u64_t, eight digits per word", iterations,
+            [](unsigned long) {
+                bench::keep(sum<true>(1, base_of(16)));
+            });
+    }
+}
@@ -0,0 +1,105 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Backend calls and throughput of buffered lp::out
+ * @file runtime/out_buffered.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <lp/types.hh>
+
+#include <out.hh>
+
+struct backend_stats {
+    unsigned long calls;
+    unsigned long bytes;
+};
+
+backend_stats stats;
+
+/// Fixed cost of driver call: register access, DMA or USB setup
+inline void driver_call() {
+    for (int i = 0; i < 20; i++) {
+        bench::clobber();
+    }
+}
+
+/// Driver with symbol send only
+struct symbol_outer {
+    __attribute__((noinline)) static void send(lp::i8_t symbol) {
+        driver_call();
+        stats.calls++;
+        stats.bytes++;
+        bench::keep(symbol);
+    }
+};
+
+/// Driver with block send
+struct block_outer {
+    __attribute__((noinline)) static void send(lp::i8_t symbol) {
+        driver_call();
+        stats.calls++;
+        stats.bytes++;
+        bench::keep(symbol);
+    }
+
+    __attribute__((noinline))
+    static void send(const lp::i8_t *data, lp::word_t size) {
+        driver_call();
+        stats.calls++;
+        stats.bytes += size;
+        bench::keep(data);
+    }
+};
+
+template <typename Outer>
+void log_line(unsigned long i) {
+    using out = lp::out<Outer>;
+
+    out::send("sensor ", static_cast<lp::u32_t>(i % 16), " value ",
+        static_cast<lp::u32_t>(i * 2654435761u), " status 0x",
+        out::make_base(out::base::hex, static_cast<lp::u32_t>(i & 0xff)),
+        '\n');
+}
+
+template <typename Outer>
+void run(const char *name) {
+    constexpr unsigned long iterations = 1000000;
+
+    stats = backend_stats{};
+    const auto start = bench::now();
+    for (unsigned long i = 0; i < iterations; i++) {
+        log_line<Outer>(i);
+    }
+    lp::out<Outer>::flush();
+    const double time = static_cast<double>(bench::now() - start);
+
+    printf("%-36s %8.2f calls/line %8.1f MB/s\n", name,
+        static_cast<double>(stats.calls) / iterations,
+        stats.bytes / time * 1000);
+}
+
+int main() {
+    run<symbol_outer>("symbol send");
+    run<block_outer>("block send, unbuffered");
+    run<lp::buffered_outer<symbol_outer, 64>>(
+        "buffered 64, symbol backend");
+    run<lp::buffered_outer<block_outer, 64>>(
+        "buffered 64, flush on newline");
+    run<lp::buffered_outer<block_outer, 256, lp::flush_on_full>>(
+        "buffered 256, flush on full");
+}
@@ -0,0 +1,197 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Mirrored output - formatting pass per backend against lp::fan_out
+ * @file runtime/out_fan_out.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <string.h>
+
+#include <lp/types.hh>
+
+#include <out.hh>
+
+using namespace lp::literals;
+
+/// Fixed cost of driver call: register access, DMA setup, lock
+inline void driver_call() {
+    for (int i = 0; i < 20; i++) {
+        bench::clobber();
+    }
+}
+
+/// Backend memory, calls and bytes
+template <int Id>
+struct backend {
+    static lp::i8_t memory[256];
+    static unsigned long bytes;
+    static unsigned long calls;
+
+    static void reset() {
+        bytes = 0;
+        calls = 0;
+    }
+
+    static void put(lp::i8_t symbol) {
+        memory[bytes++ & 0xff] = symbol;
+    }
+
+    static void put(const lp::i8_t *data, lp::word_t size) {
+        const unsigned long at = bytes;
+        for (lp::word_t i = 0; i < size; i++) {
+            memory[(at + i) & 0xff] = data[i];
+        }
+        bytes = at + size;
+    }
+};
+
+template <int Id>
+lp::i8_t backend<Id>::memory[256];
+
+template <int Id>
+unsigned long backend<Id>::bytes;
+
+template <int Id>
+unsigned long backend<Id>::calls;
+
+/// UART without block send
+struct uart_outer : backend<0> {
+    __attribute__((noinline)) static void send(lp::i8_t symbol) {
+        driver_call();
+        calls++;
+        put(symbol);
+    }
+};
+
+/// RTT up buffer, block copy
+struct rtt_outer : backend<1> {
+    __attribute__((noinline)) static void send(lp::i8_t symbol) {
+        driver_call();
+        calls++;
+        put(symbol);
+    }
+
+    __attribute__((noinline))
+    static void send(const lp::i8_t *data, lp::word_t size) {
+        driver_call();
+        calls++;
+        put(data, size);
+    }
+};
+
+/// RAM ring of log lines
+struct ring_outer : backend<2> {
+    __attribute__((noinline)) static void send(lp::i8_t symbol) {
+        driver_call();
+        calls++;
+        put(symbol);
+    }
+
+    __attribute__((noinline))
+    static void send(const lp::i8_t *data, lp::word_t size) {
+        driver_call();
+        calls++;
+        put(data, size);
+    }
+};
+
+using fan_out = lp::fan_out<lp::type_list<uart_outer, rtt_outer,
+    lp::out_sink<ring_outer, lp::out_level::warning>>>;
+
+/// Block backends only
+using block_fan_out = lp::fan_out<lp::type_list<rtt_outer, ring_outer>>;
+
+lp::u32_t value(unsigned long i) {
+    return static_cast<lp::u32_t>(i * 2654435761u);
+}
+
+template <typename Outer>
+void line(unsigned long i) {
+    lp::out<Outer>::format("sensor {} value {} status 0x{x}\n"_lit,
+        static_cast<lp::u32_t>(i % 16), value(i),
+        static_cast<lp::u32_t>(i & 0xff));
+}
+
+void reset() {
+    uart_outer::reset();
+    rtt_outer::reset();
+    ring_outer::reset();
+}
+
+void report(const char *name, double cycles) {
+    printf("%-40s %8.1f cycles/line, calls/line %.1f %.1f %.1f\n", name,
+        cycles, uart_outer::calls / 1e6, rtt_outer::calls / 1e6,
+        ring_outer::calls / 1e6);
+}
+
+int main() {
+    constexpr unsigned long iterations = 1000000;
+
+    reset();
+    fan_out::format<lp::out_level::warning>(
+        "sensor {} value {} status 0x{x}\n"_lit, 1u, 2u, 3u);
+    fan_out::format<lp::out_level::info>("info\n"_lit);
+
+    if (uart_outer::bytes != 33 || rtt_outer::bytes != 33 ||
+        ring_outer::bytes != 28 ||
+        memcmp(uart_outer::memory, ring_outer::memory, 28) != 0 ||
+        memcmp(rtt_outer::memory, ring_outer::memory, 28) != 0) {
+        printf("sinks differ\n");
+        return 1;
+    }
+
+    reset();
+    const auto start = bench::cycles();
+    for (unsigned long i = 0; i < iterations; i++) {
+        line<uart_outer>(i);
+        line<rtt_outer>(i);
+        line<ring_outer>(i);
+    }
+    report("formatting pass per backend",
+        static_cast<double>(bench::cycles() - start) / iterations);
+
+    reset();
+    const auto fan_start = bench::cycles();
+    for (unsigned long i = 0; i < iterations; i++) {
+        fan_out::format<lp::out_level::warning>(
+            "sensor {} value {} status 0x{x}\n"_lit,
+            static_cast<lp::u32_t>(i % 16), value(i),
+            static_cast<lp::u32_t>(i & 0xff));
+    }
+    report("lp::fan_out, staging 64",
+        static_cast<double>(bench::cycles() - fan_start) / iterations);
+
+    reset();
+    const auto block_start = bench::cycles();
+    for (unsigned long i = 0; i < iterations; i++) {
+        line<rtt_outer>(i);
+        line<ring_outer>(i);
+    }
+    report("block backends, pass per backend",
+        static_cast<double>(bench::cycles() - block_start) / iterations);
+
+    reset();
+    const auto block_fan_start = bench::cycles();
+    for (unsigned long i = 0; i < iterations; i++) {
+        block_fan_out::format("sensor {} value {} status 0x{x}\n"_lit,
+            static_cast<lp::u32_t>(i % 16), value(i),
+            static_cast<lp::u32_t>(i & 0xff));
+    }
+    report("block backends, lp::fan_out",
+        static_cast<double>(bench::cycles() - block_fan_start) / iterations);
+}
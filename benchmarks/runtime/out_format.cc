@@ -0,0 +1,88 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Number formatting of lp::out against division per digit
+ * @file runtime/out_format.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <lp/types.hh>
+
+#include <out.hh>
+
+using format = lp::internal::number_format;
+
+lp::i8_t buffer[33];
+
+/// Runtime base as in out::convert, not known to compiler
+lp::u8_t base_of(lp::u8_t base) {
+    bench::keep(base);
+    asm volatile("" : "+r"(base));
+
+    return base;
+}
+
+/// Numbers with uniformly distributed digit count
+lp::u32_t number(unsigned long i) {
+    static constexpr lp::u32_t scale[] = {1, 10, 100, 1000, 10000, 100000,
+        1000000, 10000000, 100000000, 1000000000};
+
+    return static_cast<lp::u32_t>(i * 2654435761u) / scale[i % 10];
+}
+
+int main() {
+    constexpr unsigned long iterations = 2000000;
+
+    bench::run_cycles("dec, division per digit", iterations,
+        [](unsigned long i) {
+            bench::keep(format::any(buffer + 32, number(i),
+                base_of(10)));
+            bench::clobber();
+        });
+
+    bench::run_cycles("dec, reciprocal and two digit table", iterations,
+        [](unsigned long i) {
+            bench::keep(format::dec(buffer + 32, number(i)));
+            bench::clobber();
+        });
+
+    bench::run_cycles("hex, division per digit", iterations,
+        [](unsigned long i) {
+            bench::keep(format::any(buffer + 32, number(i),
+                base_of(16)));
+            bench::clobber();
+        });
+
+    bench::run_cycles("hex, shift and nibble table", iterations,
+        [](unsigned long i) {
+            bench::keep(format::pow2<4>(buffer + 32, number(i)));
+            bench::clobber();
+        });
+
+    bench::run_cycles("bin, division per digit", iterations,
+        [](unsigned long i) {
+            bench::keep(format::any(buffer + 32, number(i),
+                base_of(2)));
+            bench::clobber();
+        });
+
+    bench::run_cycles("bin, shift and nibble table", iterations,
+        [](unsigned long i) {
+            bench::keep(format::pow2<1>(buffer + 32, number(i)));
+            bench::clobber();
+        });
+}
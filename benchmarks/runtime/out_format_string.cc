@@ -0,0 +1,105 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Format strings of lp::out - runtime parser against compile time one
+ * @file runtime/out_format_string.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <lp/types.hh>
+
+#include <out.hh>
+
+using namespace lp::literals;
+
+lp::i8_t memory[256];
+lp::word_t position;
+
+/// Memory backend, wraps around
+struct memory_outer {
+    static void send(lp::i8_t symbol) {
+        memory[position++ & 0xff] = symbol;
+    }
+
+    static void send(const lp::i8_t *data, lp::word_t size) {
+        for (lp::word_t i = 0; i < size; i++) {
+            memory[position++ & 0xff] = data[i];
+        }
+    }
+};
+
+using out = lp::out<memory_outer>;
+
+/// Printf style parser walking the string on every call
+__attribute__((noinline))
+void runtime_format(const lp::i8_t *format, const lp::u32_t *args) {
+    const lp::i8_t *text = format;
+
+    while (*format != '\0') {
+        if (*format != '{') {
+            format++;
+            continue;
+        }
+
+        memory_outer::send(text, format - text);
+
+        out::base base = out::base::dec;
+        if (format[1] == 'x') {
+            base = out::base::hex;
+            format++;
+        }
+
+        format += 2;
+        text = format;
+        out::send(*args++, base);
+    }
+
+    memory_outer::send(text, format - text);
+}
+
+lp::u32_t value(unsigned long i) {
+    return static_cast<lp::u32_t>(i * 2654435761u);
+}
+
+int main() {
+    constexpr unsigned long iterations = 2000000;
+
+    bench::run_cycles("runtime parsed format string", iterations,
+        [](unsigned long i) {
+            const lp::u32_t args[] = {static_cast<lp::u32_t>(i % 16),
+                value(i), static_cast<lp::u32_t>(i & 0xff)};
+
+            runtime_format("sensor {} value {} status 0x{x}\n", args);
+            bench::clobber();
+        });
+
+    bench::run_cycles("compile time format string", iterations,
+        [](unsigned long i) {
+            out::format("sensor {} value {} status 0x{x}\n"_lit,
+                static_cast<lp::u32_t>(i % 16), value(i),
+                static_cast<lp::u32_t>(i & 0xff));
+            bench::clobber();
+        });
+
+    bench::run_cycles("variadic send", iterations,
+        [](unsigned long i) {
+            out::send("sensor ", static_cast<lp::u32_t>(i % 16), " value ",
+                value(i), " status 0x", out::make_base(out::base::hex,
+                    static_cast<lp::u32_t>(i & 0xff)), '\n');
+            bench::clobber();
+        });
+}
@@ -0,0 +1,115 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Column scan of structure of arrays against array of tuples
+ * @file runtime/soa_scan.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <lp/soa_array.hh>
+#include <lp/types.hh>
+
+#include <tuple.hh>
+
+constexpr lp::word_t samples = 4096;
+
+using sample = std::tuple<lp::u32_t, lp::i16_t, lp::u8_t>;
+
+sample aos[samples];
+
+lp::soa_array<samples, lp::u32_t, lp::i16_t, lp::u8_t> soa;
+
+__attribute__((noinline)) int aos_sum() {
+    int sum = 0;
+
+    for (const auto &s : aos) {
+        sum += std::get<1>(s);
+    }
+
+    return sum;
+}
+
+__attribute__((noinline)) int soa_sum() {
+    int sum = 0;
+
+    for (auto value : soa.column<1>()) {
+        sum += value;
+    }
+
+    return sum;
+}
+
+__attribute__((noinline)) int aos_row_sum() {
+    int sum = 0;
+
+    for (lp::word_t i = 0; i < samples; i++) {
+        sum += std::get<1>(aos[i]) * std::get<2>(aos[i]);
+    }
+
+    return sum;
+}
+
+__attribute__((noinline)) int soa_row_sum() {
+    int sum = 0;
+
+    for (lp::word_t i = 0; i < samples; i++) {
+        const auto row = soa[i];
+        sum += std::get<1>(row) * std::get<2>(row);
+    }
+
+    return sum;
+}
+
+int main() {
+    constexpr unsigned long iterations = 20000;
+
+    bench::random random{1};
+
+    for (lp::word_t i = 0; i < samples; i++) {
+        const auto value = random();
+        aos[i] = sample(value, static_cast<lp::i16_t>(value),
+            static_cast<lp::u8_t>(value >> 16));
+        soa[i] = aos[i];
+    }
+
+    printf("sizeof sample row: %zu bytes, soa row: %zu bytes\n",
+        sizeof(sample), sizeof(soa) / samples);
+
+    bench::run("array of tuples, column sum (4096 rows)", iterations,
+        [](unsigned long) {
+            bench::clobber();
+            bench::keep(aos_sum());
+        });
+
+    bench::run("soa_array, column sum (4096 rows)", iterations,
+        [](unsigned long) {
+            bench::clobber();
+            bench::keep(soa_sum());
+        });
+
+    bench::run("array of tuples, two column product (4096 rows)",
+        iterations, [](unsigned long) {
+            bench::clobber();
+            bench::keep(aos_row_sum());
+        });
+
+    bench::run("soa_array, two column row views (4096 rows)", iterations,
+        [](unsigned long) {
+            bench::clobber();
+            bench::keep(soa_row_sum());
+        });
+}
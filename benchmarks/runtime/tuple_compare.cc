@@ -0,0 +1,198 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Tuple == against element by element compare with branch per element,
+ * on sorted keys (predictable) and on random key pairs (unpredictable)
+ * @file runtime/tuple_compare.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <lp/types.hh>
+
+#include <tuple.hh>
+#include <utility.hh>
+
+constexpr lp::word_t keys = 1024;
+
+using key3_t = std::tuple<lp::u16_t, lp::u16_t, lp::u32_t>;
+using key_wide_t = std::tuple<lp::u32_t, lp::u32_t, lp::u32_t, lp::u32_t>;
+
+/// Heap sort of keys before deduplication
+template <typename T>
+void sift_down(T *data, lp::word_t root, lp::word_t size) {
+    for (auto child = 2 * root + 1; child < size; child = 2 * root + 1) {
+        if (child + 1 < size && data[child] < data[child + 1]) {
+            child++;
+        }
+
+        if (!(data[root] < data[child])) {
+            return;
+        }
+
+        std::swap(data[root], data[child]);
+        root = child;
+    }
+}
+
+template <typename T>
+void heap_sort(T *data, lp::word_t size) {
+    for (auto i = size / 2; i > 0; i--) {
+        sift_down(data, i - 1, size);
+    }
+
+    for (auto end = size - 1; end > 0; end--) {
+        std::swap(data[0], data[end]);
+        sift_down(data, 0, end);
+    }
+}
+
+/// Element by element compare, branch per element
+struct branch_equal {
+    template <typename ...Types>
+    bool operator()(const std::tuple<Types...> &t,
+        const std::tuple<Types...> &u) const {
+        return equal(t, u, std::index_sequence_for<Types...>{});
+    }
+
+    template <typename T>
+    static bool equal(const T &, const T &, std::index_sequence<>) {
+        return true;
+    }
+
+    template <typename T, std::size_t First, std::size_t ...Rest>
+    static bool equal(const T &t, const T &u,
+        std::index_sequence<First, Rest...>) {
+        return std::get<First>(t) == std::get<First>(u) &&
+            equal(t, u, std::index_sequence<Rest...>{});
+    }
+};
+
+struct tuple_equal {
+    template <typename T>
+    bool operator()(const T &t, const T &u) const {
+        return t == u;
+    }
+};
+
+/// Number of unique keys in sorted sequence
+template <typename T, typename Equal>
+lp::word_t unique(const T *data, lp::word_t size, Equal equal) {
+    lp::word_t count = 1;
+
+    for (lp::word_t i = 1; i < size; i++) {
+        count += !equal(data[i], data[i - 1]);
+    }
+
+    return count;
+}
+
+/// Number of equal pairs of two key sequences
+template <typename T, typename Equal>
+lp::word_t matches(const T *a, const T *b, lp::word_t size, Equal equal) {
+    lp::word_t count = 0;
+
+    for (lp::word_t i = 0; i < size; i++) {
+        count += equal(a[i], b[i]);
+    }
+
+    return count;
+}
+
+template <typename T>
+struct key_set {
+    T data[keys];
+
+    template <typename Make>
+    void fill(Make make) {
+        bench::random random{7};
+
+        for (auto &key : data) {
+            key = make(random() % 64, random());
+        }
+
+        heap_sort(data, keys);
+    }
+};
+
+key_set<key3_t> set3;
+key_set<key_wide_t> set_wide;
+
+/// Every element of pair is equal with probability 1/2, sequence is long
+/// enough for branch predictor not to learn it
+constexpr lp::word_t pairs = 1 << 16;
+
+key_wide_t pairs_a[pairs];
+key_wide_t pairs_b[pairs];
+
+int main() {
+    constexpr unsigned long iterations = 20000;
+
+    set3.fill([](unsigned a, unsigned b) {
+        return key3_t(static_cast<lp::u16_t>(a >> 2),
+            static_cast<lp::u16_t>(a & 3), b % 4);
+    });
+
+    set_wide.fill([](unsigned a, unsigned b) {
+        return key_wide_t(a >> 3, a & 7, b % 2, 1);
+    });
+
+    bench::random random{11};
+
+    for (lp::word_t i = 0; i < pairs; i++) {
+        const unsigned bits = random() >> 20;
+
+        pairs_a[i] = key_wide_t(1, 2, 3, 4);
+        pairs_b[i] = key_wide_t(1 + (bits & 1), 2 + (bits >> 1 & 1),
+            3 + (bits >> 2 & 1), 4 + (bits >> 3 & 1));
+    }
+
+    bench::run("unique tuple<u16_t, u16_t, u32_t>, branch per element",
+        iterations, [](unsigned long) {
+            bench::clobber();
+            bench::keep(unique(set3.data, keys, branch_equal{}));
+        });
+
+    bench::run("unique tuple<u16_t, u16_t, u32_t>, tuple ==", iterations,
+        [](unsigned long) {
+            bench::clobber();
+            bench::keep(unique(set3.data, keys, tuple_equal{}));
+        });
+
+    bench::run("unique tuple<u32_t x 4>, branch per element", iterations,
+        [](unsigned long) {
+            bench::clobber();
+            bench::keep(unique(set_wide.data, keys, branch_equal{}));
+        });
+
+    bench::run("unique tuple<u32_t x 4>, tuple ==", iterations,
+        [](unsigned long) {
+            bench::clobber();
+            bench::keep(unique(set_wide.data, keys, tuple_equal{}));
+        });
+
+    bench::run("random pairs tuple<u32_t x 4>, branch per element",
+        iterations / 64, [](unsigned long) {
+            bench::clobber();
+            bench::keep(matches(pairs_a, pairs_b, pairs, branch_equal{}));
+        });
+
+    bench::run("random pairs tuple<u32_t x 4>, tuple ==", iterations / 64,
+        [](unsigned long) {
+            bench::clobber();
+            bench::keep(matches(pairs_a, pairs_b, pairs, tuple_equal{}));
+        });
+}
@@ -0,0 +1,88 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Small tuple return by value benchmark against plain struct
+ * @file runtime/tuple_return.cc
+ * @author Boris Vinogradov
+ */
+
+#include "bench.hh"
+
+#include <lp/types.hh>
+
+#include <tuple.hh>
+
+struct pair {
+    lp::u32_t first;
+    lp::u32_t second;
+};
+
+__attribute__((noinline)) std::tuple<lp::u32_t, lp::u32_t>
+tuple_divmod(lp::u32_t a, lp::u32_t b) {
+    return std::make_tuple(a / b, a % b);
+}
+
+__attribute__((noinline)) pair struct_divmod(lp::u32_t a, lp::u32_t b) {
+    return pair{a / b, a % b};
+}
+
+struct triple {
+    lp::u32_t first;
+    lp::u16_t second;
+    lp::u8_t third;
+};
+
+__attribute__((noinline)) triple struct_split(lp::u32_t a) {
+    return triple{a, static_cast<lp::u16_t>(a >> 8),
+        static_cast<lp::u8_t>(a)};
+}
+
+__attribute__((noinline)) std::tuple<lp::u32_t, lp::u16_t, lp::u8_t>
+tuple_split(lp::u32_t a) {
+    return std::make_tuple(a, static_cast<lp::u16_t>(a >> 8),
+        static_cast<lp::u8_t>(a));
+}
+
+int main() {
+    constexpr unsigned long iterations = 50000000;
+
+    printf("trivially copyable tuple<u32_t, u32_t>: %d\n",
+        std::is_trivially_copyable<
+            std::tuple<lp::u32_t, lp::u32_t>>::value);
+
+    bench::run("struct {u32_t, u32_t} return", iterations,
+        [](unsigned long i) {
+            const auto r = struct_divmod(i | 1, 7);
+            bench::keep(r.first + r.second);
+        });
+
+    bench::run("tuple<u32_t, u32_t> return", iterations,
+        [](unsigned long i) {
+            const auto r = tuple_divmod(i | 1, 7);
+            bench::keep(std::get<0>(r) + std::get<1>(r));
+        });
+
+    bench::run("struct {u32_t, u16_t, u8_t} return", iterations,
+        [](unsigned long i) {
+            const auto r = struct_split(i);
+            bench::keep(r.first + r.second + r.third);
+        });
+
+    bench::run("tuple<u32_t, u16_t, u8_t> return", iterations,
+        [](unsigned long i) {
+            const auto r = tuple_split(i);
+            bench::keep(std::get<0>(r) + std::get<1>(r) + std::get<2>(r));
+        });
+}
@@ -21,9 +21,455 @@
 #ifndef LP_CC_LIB_IN_HH
 #define LP_CC_LIB_IN_HH
 
-#include <types.hh>
+#include <lp/types.hh>
+#include <type_traits.hh>
 
 namespace lp {
+    namespace internal {
+        /// Powers of ten for words of decimal digits
+        template <typename T = void>
+        struct decimal_powers {
+            static constexpr u64_t values[9] = {1, 10, 100, 1000, 10000,
+                100000, 1000000, 10000000, 100000000};
+        };
+
+        template <typename T>
+        constexpr u64_t decimal_powers<T>::values[];
+
+        /// Number parsing from symbols, stops at space or invalid symbol
+        struct number_parse {
+            /// Digit of base up to 36, base or more for invalid symbol
+            static constexpr u8_t digit(i8_t ch) {
+                if (ch >= 'a')
+                    ch -= 0x20;
+                ch -= '0';
+                if (ch >= 17) {
+                    ch -= 7;
+
+                    if (ch <= 9) {
+                        return 0xff;
+                    }
+                }
+
+                return static_cast<u8_t>(ch);
+            }
+
+            /// Number with base prefix: 0a - 36, 0x - 16, 0b - 2, 0 - 8
+            template <typename T>
+            static constexpr void convert(const i8_t *beg, const i8_t *end,
+                T &number) {
+                u8_t base = 10;
+
+                if (*beg == '0') {
+                    beg++;
+                    if (*beg == 'a') {
+                        base = 36;
+                    } else if (*beg == 'x') {
+                        base = 16;
+                    } else if (*beg == 'b') {
+                        base = 2;
+                    } else if (*beg <= ' ') {
+                        return;
+                    } else {
+                        base = 8;
+                        beg--;
+                    }
+                    beg++;
+                }
+
+                digits(beg, end, base, number);
+            }
+
+            /// Digits of base, eight decimal or hex digits are converted
+            /// at once while they fill whole word, the rest by scalar loop
+            template <typename T>
+            static constexpr void digits(const i8_t *beg, const i8_t *end,
+                const u8_t base, T &number) {
+                digits_scalar(digits_swar(beg, end, base, number), end,
+                    base, number);
+            }
+
+            static constexpr u64_t byte_at(const i8_t *data,
+                const word_t index) {
+                return static_cast<u64_t>(static_cast<u8_t>(data[index])) <<
+                    (index * 8);
+            }
+
+            /// Eight symbols as little endian word, unrolled form is
+            /// merged to single load by compiler
+            static constexpr u64_t load_word(const i8_t *data) {
+                return byte_at(data, 0) | byte_at(data, 1) |
+                    byte_at(data, 2) | byte_at(data, 3) | byte_at(data, 4) |
+                    byte_at(data, 5) | byte_at(data, 6) | byte_at(data, 7);
+            }
+
+            /// Top bit of every byte of word between low and high,
+            /// bytes must be less than 0x80
+            static constexpr u64_t between(const u64_t word, const u8_t low,
+                const u8_t high) {
+                constexpr u64_t ones = 0x0101010101010101ull;
+
+                return (word + ones * (0x80 - low)) &
+                    ~(word + ones * (0x7f - high)) & ones * 0x80;
+            }
+
+            /// Eight digits of bytes as number, first byte is the most
+            /// significant, lanes are merged without carry between them
+            template <u64_t Base>
+            static constexpr u64_t merge_digits(u64_t digits) {
+                digits = (digits * Base + (digits >> 8)) &
+                    0x00ff00ff00ff00ffull;
+                digits = (digits * (Base * Base) + (digits >> 16)) &
+                    0x0000ffff0000ffffull;
+
+                return (digits * (Base * Base * Base * Base) +
+                    (digits >> 32)) & 0xffffffffull;
+            }
+
+            /// Leading digits of word of base 10 or 16, their value and
+            /// count, the rest of word is shifted out
+            static constexpr u64_t word_digits(const u64_t word,
+                const u8_t base, word_t &count) {
+                constexpr u64_t ones = 0x0101010101010101ull;
+                u64_t digits = word & ones * 0x0f;
+                u64_t valid = between(word, '0', '9');
+
+                if (base == 16) {
+                    const u64_t letters =
+                        between(word | ones * 0x20, 'a', 'f');
+
+                    valid |= letters;
+                    digits += (letters >> 7) * 9;
+                }
+
+                // carries of bytes above 0x7f go to following bytes only
+                const u64_t invalid =
+                    (valid ^ ones * 0x80) | (word & ones * 0x80);
+                count = invalid == 0 ? 8 : __builtin_ctzll(invalid) / 8;
+
+                if (count == 0) {
+                    return 0;
+                }
+
+                digits <<= (8 - count) * 8;
+
+                return base == 10 ?
+                    merge_digits<10>(digits) : merge_digits<16>(digits);
+            }
+
+            /// Words of decimal or hex digits, tail of at least 8 symbols
+            /// long text is read by word ending at end with consumed
+            /// symbols shifted out, returns first symbol of scalar loop
+            template <typename T>
+            static constexpr const i8_t *digits_swar(const i8_t *beg,
+                const i8_t *end, const u8_t base, T &number) {
+                if (base != 10 && base != 16) {
+                    return beg;
+                }
+
+                const i8_t *const first = beg;
+
+                for (;;) {
+                    const word_t rest = end - beg;
+                    u64_t word = 0;
+
+                    if (rest >= 8) {
+                        word = load_word(beg);
+                    } else if (rest > 0 && end - first >= 8) {
+                        word = load_word(end - 8) >> ((8 - rest) * 8);
+                    } else {
+                        break;
+                    }
+
+                    word_t count = 0;
+                    const u64_t value = word_digits(word, base, count);
+
+                    if (count == 0) {
+                        break;
+                    }
+
+                    number = static_cast<T>(number * (base == 16 ?
+                        1ull << (count * 4) : decimal_powers<>::values[count]) +
+                        value);
+                    beg += count;
+
+                    if (count < 8) {
+                        break;
+                    }
+                }
+
+                return beg;
+            }
+
+            /// Digit per iteration, number wider than machine word is
+            /// accumulated in u32_t chunks and multiplied once per chunk
+            template <typename T>
+            static constexpr void digits_scalar(const i8_t *beg,
+                const i8_t *end, const u8_t base, T &number) {
+                if (sizeof(T) > sizeof(word_t)) {
+                    digits_chunked(beg, end, base, number);
+                    return;
+                }
+
+                while (beg < end && *beg > ' ') {
+                    const u8_t dig = digit(*beg++);
+                    if (dig >= base) {
+                        break;
+                    }
+
+                    number = number * base + dig;
+                }
+            }
+
+            template <typename T>
+            static constexpr void digits_chunked(const i8_t *beg,
+                const i8_t *end, const u8_t base, T &number) {
+                const u32_t limit = 0xffffffffu / base;
+                u32_t part = 0;
+                u32_t scale = 1;
+
+                while (beg < end && *beg > ' ') {
+                    const u8_t dig = digit(*beg++);
+                    if (dig >= base) {
+                        break;
+                    }
+
+                    part = part * base + dig;
+                    scale *= base;
+
+                    if (scale > limit) {
+                        number = number * scale + part;
+                        part = 0;
+                        scale = 1;
+                    }
+                }
+
+                number = number * scale + part;
+            }
+        };
+    } // namespace internal
+
+    /// Push parser of number, resumes on every symbol or chunk of symbols,
+    /// so it can be fed from interrupt handler. Leading spaces are skipped,
+    /// number has optional '-' and base prefix of in: 0a, 0x, 0b, 0 and
+    /// ends with space or new line symbol or with finish() at end of input.
+    /// It is not faster than blocking lp::in: push per symbol takes about
+    /// as long as in::recv per symbol, only long chunks of feed gain
+    /// (benchmarks/runtime/number_parser)
+    template <typename T>
+    class number_parser {
+        using unsigned_t = std::make_unsigned_t<T>;
+    public:
+        enum struct status : u8_t {
+            more,
+            done,
+            overflow,
+            invalid
+        };
+
+        constexpr number_parser() = default;
+
+        /// Feed symbols, returns number of consumed symbols, parser stops
+        /// after terminating space and keeps the rest of chunk
+        constexpr word_t feed(const i8_t *data, const word_t size) {
+            word_t i = 0;
+
+            while (i < size && state_ < state::done) {
+                if (state_ == state::digits) {
+                    return digits(data, i, size);
+                }
+
+                const i8_t ch = data[i++];
+
+                switch (state_) {
+                    case state::space:
+                        if (ch <= ' ') {
+                            break;
+                        }
+                        if (ch == '-') {
+                            negative_ = true;
+                            state_ = state::sign;
+                            break;
+                        }
+                        i -= start(ch);
+                        break;
+                    case state::sign:
+                        i -= start(ch);
+                        break;
+                    case state::zero:
+                        i -= prefix(ch);
+                        break;
+                    default:
+                        if (ch <= ' ') {
+                            state_ = state::invalid;
+                            break;
+                        }
+                        state_ = state::digits;
+                        i--;
+                        break;
+                }
+            }
+
+            return i;
+        }
+
+        /// Digit inside of number is parsed inline, other symbols by feed
+        constexpr status push(const i8_t symbol) {
+            if (state_ == state::digits && magnitude_ < cutoff_) {
+                const u8_t dig = internal::number_parse::digit(symbol);
+
+                if (symbol > ' ' && dig < base_) {
+                    magnitude_ = magnitude_ * base_ + dig;
+                    return status::more;
+                }
+            }
+
+            feed(&symbol, 1);
+            return result();
+        }
+
+        /// End of input - number without terminating space is done,
+        /// input without digits ("", "-", "0x") is invalid
+        constexpr status finish() {
+            if (state_ == state::digits || state_ == state::zero) {
+                state_ = state::done;
+            } else if (state_ < state::done) {
+                state_ = state::invalid;
+            }
+
+            return result();
+        }
+
+        constexpr status result() const {
+            switch (state_) {
+                case state::done:
+                    return status::done;
+                case state::overflow:
+                    return status::overflow;
+                case state::invalid:
+                    return status::invalid;
+                default:
+                    return status::more;
+            }
+        }
+
+        /// Parsed number, valid with status::done
+        constexpr T value() const {
+            return static_cast<T>(negative_ ? 0 - magnitude_ : magnitude_);
+        }
+
+        constexpr void reset() {
+            *this = number_parser{};
+        }
+    private:
+        enum struct state : u8_t {
+            space,
+            sign,
+            zero,
+            first,
+            digits,
+            done,
+            overflow,
+            invalid
+        };
+
+        /// Returns 1 when symbol is first digit and must be parsed again
+        constexpr word_t start(const i8_t ch) {
+            if (ch == '0') {
+                state_ = state::zero;
+            } else if (ch <= ' ') {
+                state_ = state::invalid;
+            } else {
+                set_base(10);
+                state_ = state::digits;
+                return 1;
+            }
+
+            return 0;
+        }
+
+        constexpr word_t prefix(const i8_t ch) {
+            if (ch == 'a') {
+                set_base(36);
+                state_ = state::first;
+            } else if (ch == 'x') {
+                set_base(16);
+                state_ = state::first;
+            } else if (ch == 'b') {
+                set_base(2);
+                state_ = state::first;
+            } else if (ch <= ' ') {
+                state_ = state::done;
+            } else {
+                set_base(8);
+                state_ = state::digits;
+                return 1;
+            }
+
+            return 0;
+        }
+
+        /// Limits of magnitude are divided once per number
+        constexpr void set_base(const u8_t base) {
+            const unsigned_t all = static_cast<unsigned_t>(~unsigned_t{0});
+            const unsigned_t max = std::is_signed<T>::value ?
+                static_cast<unsigned_t>((all >> 1) + (negative_ ? 1 : 0)) :
+                all;
+
+            base_ = base;
+            cutoff_ = max / base;
+            cutlim_ = static_cast<u8_t>(max % base);
+        }
+
+        /// Digits of number without state dispatch, state is kept in
+        /// locals, stores to members could alias symbols of chunk
+        constexpr word_t digits(const i8_t *data, word_t i,
+            const word_t size) {
+            const unsigned_t cutoff = cutoff_;
+            const u8_t cutlim = cutlim_;
+            const u8_t base = base_;
+            unsigned_t magnitude = magnitude_;
+            state next = state::digits;
+
+            for (; i < size; i++) {
+                const i8_t ch = data[i];
+                if (ch <= ' ') {
+                    next = state::done;
+                    i++;
+                    break;
+                }
+
+                const u8_t dig = internal::number_parse::digit(ch);
+                if (dig >= base) {
+                    next = state::invalid;
+                    i++;
+                    break;
+                }
+
+                if (magnitude >= cutoff &&
+                    (magnitude > cutoff || dig > cutlim)) {
+                    next = state::overflow;
+                    i++;
+                    break;
+                }
+
+                magnitude = magnitude * base + dig;
+            }
+
+            magnitude_ = magnitude;
+            state_ = next;
+
+            return i;
+        }
+
+        unsigned_t magnitude_ = 0;
+        unsigned_t cutoff_ = 0;
+        u8_t cutlim_ = 0;
+        u8_t base_ = 10;
+        state state_ = state::space;
+        bool negative_ = false;
+    };
+
     template <typename Inner, bool echo = true, typename Type = u32_t>
     class in {
     public:
@@ -57,11 +503,14 @@ namespace lp {
 
         template <typename T>
         static constexpr void recv(T &number) {
+            // digits of base 2 with prefix and sign
+            constexpr auto size =
+                (sizeof(T) * 8 > t_bit_size ? sizeof(T) * 8 : t_bit_size) + 3;
             number = 0;
-            i8_t buffer[t_bit_size + 1];
+            i8_t buffer[size + 1];
 
             auto beg = buffer;
-            auto end = beg + t_bit_size;
+            auto end = beg + size;
             i8_t ch;
             auto sig = false;
 
@@ -77,14 +526,17 @@ namespace lp {
                 *beg++ = ch;
                 ch = inner::recv();
             }
+            *beg = '\0';
 
+            // words of digits are read up to end of received text only
+            end = beg;
             beg = buffer;
             if (*beg == '-') {
                 sig = true;
                 beg++;
             }
 
-            convert(beg, end, number);
+            internal::number_parse::convert(beg, end, number);
 
             if (sig)
                 number = 0 - number;
@@ -100,51 +552,6 @@ namespace lp {
             return (ch == '\n' || ch == '\r') ?
                 true : false;
         }
-
-        template <typename T>
-        static constexpr void convert(i8_t *beg, i8_t *end, T &number) {
-            auto base = 10;
-
-            if (*beg == '0') {
-                beg++;
-                if (*beg == 'a') {
-                    base = 36;
-                } else if (*beg == 'x') {
-                    base = 16;
-                } else if (*beg == 'b') {
-                    base = 2;
-                } else if (*beg <= ' ') {
-                    return;
-                } else {
-                    base = 8;
-                    beg--;
-                }
-                beg++;
-            }
-
-            while (beg < end) {
-                i8_t ch = *beg;
-                if (ch <= ' ') {
-                    break;
-                }
-                if (ch >= 'a')
-                    ch -= 0x20;
-                ch -= '0';
-                if (ch >= 17) {
-                    ch -= 7;
-
-                    if (ch <= 9) {
-                        return;
-                    }
-                }
-                if (ch >= base) {
-                    return;
-                }
-
-                number = number * base + ch;
-                beg++;
-            }
-        }
     };
 }
 
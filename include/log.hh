@@ -0,0 +1,531 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Deferred binary log - call site id and raw arguments instead of text
+ * @file log.hh
+ * @author Boris Vinogradov
+ */
+
+#include <lp/types.hh>
+#include <out.hh>
+#include <type_traits.hh>
+#include <utility.hh>
+
+#ifndef LP_CC_LIB_LOG_HH
+#define LP_CC_LIB_LOG_HH
+
+/// Section of log string table, it is not needed in target memory
+#ifndef LP_CC_LIB_LOG_SECTION
+#define LP_CC_LIB_LOG_SECTION "lp_log"
+#endif
+
+/// Section is not allocated, image tools still copy it from ELF file,
+/// "a" is for images that read their own table
+#ifndef LP_CC_LIB_LOG_SECTION_FLAGS
+#define LP_CC_LIB_LOG_SECTION_FLAGS ""
+#endif
+
+namespace lp {
+    namespace internal {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+        static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+            "lp::log string table is written for little endian targets");
+#endif
+
+        /// Argument of log frame: signature code and encoding
+        template <typename T>
+        struct log_arg {
+            static_assert(sizeof(T) == 0,
+                "lp::log: argument type is not supported");
+        };
+
+        template <i8_t Code, typename T>
+        struct log_number {
+            static constexpr i8_t code = Code;
+            static constexpr word_t size = sizeof(T);
+        };
+
+        template <>
+        struct log_arg<i8_t> : log_number<'c', i8_t> {};
+
+        template <>
+        struct log_arg<u8_t> : log_number<'B', u8_t> {};
+
+        template <>
+        struct log_arg<i16_t> : log_number<'h', i16_t> {};
+
+        template <>
+        struct log_arg<u16_t> : log_number<'H', u16_t> {};
+
+        template <>
+        struct log_arg<i32_t> : log_number<'i', i32_t> {};
+
+        template <>
+        struct log_arg<u32_t> : log_number<'I', u32_t> {};
+
+        template <>
+        struct log_arg<i64_t> : log_number<'q', i64_t> {};
+
+        template <>
+        struct log_arg<u64_t> : log_number<'Q', u64_t> {};
+
+        /// String is sent as length byte and up to 255 symbols
+        template <>
+        struct log_arg<const i8_t *> {
+            static constexpr i8_t code = 's';
+            static constexpr word_t size = 1;
+        };
+
+        template <>
+        struct log_arg<i8_t *> : log_arg<const i8_t *> {};
+
+        /// Format has only symbols, {{, }} and fields {}, {x}, {o}, {b}
+        /// as read by lp::log_decoder, '\0' would end record of table
+        constexpr bool log_format_valid(const i8_t *format,
+            const word_t size) {
+            for (word_t i = 0; i < size; i++) {
+                if (format[i] == '\0') {
+                    return false;
+                }
+            }
+
+            return format_valid(format, size);
+        }
+
+        /// FNV-1a hash of record body
+        constexpr u32_t log_hash(const i8_t *data, const word_t size) {
+            u32_t hash = 2166136261u;
+
+            for (word_t i = 0; i < size; i++) {
+                hash ^= static_cast<u8_t>(data[i]);
+                hash *= 16777619u;
+            }
+
+            return hash;
+        }
+
+        /// Four symbols of record, zero padded
+        template <typename Record>
+        constexpr u32_t log_chunk(const word_t index) {
+            u32_t chunk = 0;
+
+            for (word_t i = 0; i < 4; i++) {
+                const word_t at = index * 4 + i;
+
+                if (at < Record::size()) {
+                    chunk |= static_cast<u32_t>(
+                        static_cast<u8_t>(Record::data[at])) << (i * 8);
+                }
+            }
+
+            return chunk;
+        }
+
+        template <typename Record, typename Indexes>
+        struct log_table_emit;
+
+        template <typename Record, word_t ...Index>
+        struct log_table_emit<Record, std::index_sequence<Index...>> {
+            static constexpr u32_t chunks[] = {log_chunk<Record>(Index)...};
+
+            /// Record is appended to string table section by assembler,
+            /// template data ignores section attribute on some compilers
+            static void emit() {
+                const bool expand[] = {false, (__extension__ ({
+                    asm volatile (".pushsection " LP_CC_LIB_LOG_SECTION
+                        ",\"" LP_CC_LIB_LOG_SECTION_FLAGS "\",%%progbits"
+                        "\n\t.4byte %c0\n\t.popsection"
+                        :: "i"(chunks[Index]));
+                }), false)...};
+                static_cast<void>(expand);
+            }
+        };
+
+        template <typename Record, word_t ...Index>
+        constexpr u32_t
+        log_table_emit<Record, std::index_sequence<Index...>>::chunks[];
+
+        /// Size of frame without string symbols
+        template <typename ...Args>
+        constexpr word_t log_frame_size() {
+            const word_t sizes[] = {0, log_arg<Args>::size...};
+            word_t sum = sizeof(u32_t);
+
+            for (auto size : sizes) {
+                sum += size;
+            }
+
+            return sum;
+        }
+
+        /// Size of argument of signature code, strings have length byte
+        constexpr word_t log_code_size(const i8_t code) {
+            switch (code) {
+                case 'h': case 'H':
+                    return 2;
+                case 'i': case 'I':
+                    return 4;
+                case 'q': case 'Q':
+                    return 8;
+                default:
+                    return 1;
+            }
+        }
+
+        /// Call site of format and argument types
+        template <typename Format, typename ...Args>
+        struct log_site;
+
+        template <i8_t ...Chars, typename ...Args>
+        struct log_site<literal<Chars...>, Args...> {
+            static_assert(log_format_valid(literal<Chars...>::data,
+                sizeof...(Chars)), "lp::log: format has field other than "
+                "{}, {x}, {o}, {b}, unpaired brace or '\\0'");
+
+            static_assert(format_fields(literal<Chars...>::data,
+                sizeof...(Chars)) == sizeof...(Args),
+                "lp::log: number of {} placeholders and arguments differs");
+
+            /// Signature, '\0', format
+            using body = literal<log_arg<Args>::code..., '\0', Chars...>;
+
+            static constexpr u32_t id = log_hash(body::data, body::size());
+
+            /// Id in little endian, body, '\0'
+            using record = literal<
+                static_cast<i8_t>(id & 0xff),
+                static_cast<i8_t>(id >> 8 & 0xff),
+                static_cast<i8_t>(id >> 16 & 0xff),
+                static_cast<i8_t>(id >> 24 & 0xff),
+                log_arg<Args>::code..., '\0', Chars..., '\0'>;
+
+            static constexpr word_t frame_size = log_frame_size<Args...>();
+
+            static void emit() {
+                log_table_emit<record,
+                    std::make_index_sequence<(record::size() + 3) / 4>>::emit();
+            }
+        };
+
+        template <i8_t ...Chars, typename ...Args>
+        constexpr u32_t log_site<literal<Chars...>, Args...>::id;
+
+        /// Frame of id and raw arguments
+        template <typename Outer, word_t Size>
+        class log_frame {
+        public:
+            /// Raw copy, target is little endian
+            template <typename T>
+            void put(const T value, std::true_type) {
+                const i8_t *bytes = reinterpret_cast<const i8_t *>(&value);
+
+                for (word_t i = 0; i < sizeof(T); i++) {
+                    buffer_[size_ + i] = bytes[i];
+                }
+
+                size_ += sizeof(T);
+            }
+
+            void put(const i8_t *string, std::false_type) {
+                word_t length = 0;
+                while (length < 255 && string[length] != '\0') {
+                    length++;
+                }
+
+                buffer_[size_++] = static_cast<i8_t>(length);
+                send();
+                send_block<Outer>(string, length);
+            }
+
+            template <typename T>
+            void put(const T &value) {
+                put(value, std::is_integral<T>{});
+            }
+
+            void send() {
+                if (size_ > 0) {
+                    send_block<Outer>(buffer_, size_);
+                    size_ = 0;
+                }
+            }
+        private:
+            i8_t buffer_[Size];
+            word_t size_ = 0;
+        };
+
+        /// Read little endian number of frame
+        template <typename T>
+        constexpr T log_read(const i8_t *data) {
+            using unsigned_t = std::make_unsigned_t<T>;
+            unsigned_t value = 0;
+
+            for (word_t i = 0; i < sizeof(T); i++) {
+                value |= static_cast<unsigned_t>(
+                    static_cast<u8_t>(data[i])) << (i * 8);
+            }
+
+            return static_cast<T>(value);
+        }
+    } // namespace internal
+
+    /// Deferred binary log, each call site sends its compile time id and
+    /// raw arguments, text is restored by lp::log_decoder from string table
+    /// of LP_CC_LIB_LOG_SECTION section
+    template <typename Outer>
+    class log {
+    public:
+        using outer = Outer;
+
+        /// Format is "text"_lit or LP_CC_LIB_LIT("text"), {} - decimal,
+        /// {x} - hex, {o} - octal, {b} - binary, {{ and }} - braces
+        template <i8_t ...Chars, typename ...Args>
+        static void send(literal<Chars...>, const Args &...args) {
+            using site = internal::log_site<literal<Chars...>,
+                std::decay_t<const Args &>...>;
+
+            site::emit();
+
+            internal::log_frame<outer, site::frame_size> frame;
+            frame.put(site::id);
+
+            const bool expand[] = {false, (frame.put(
+                static_cast<std::decay_t<const Args &>>(args)), false)...};
+            static_cast<void>(expand);
+
+            frame.send();
+        }
+
+        template <i8_t ...Chars, typename ...Args>
+        static constexpr u32_t id(literal<Chars...>, const Args &...) {
+            return internal::log_site<literal<Chars...>,
+                std::decay_t<const Args &>...>::id;
+        }
+
+        /// Send buffered output of outer
+        static void flush() {
+            internal::flush<outer>();
+        }
+    };
+
+    /// Decoder of lp::log frames, text is sent to lp::out<Outer>
+    template <typename Outer>
+    class log_decoder {
+    public:
+        using out = lp::out<Outer>;
+        using base = typename out::base;
+
+        /// String table is LP_CC_LIB_LOG_SECTION section of image
+        constexpr log_decoder(const i8_t *table, const word_t size)
+            : table_(table), size_(size) {}
+
+        /// Record of id or nullptr
+        constexpr const i8_t *find(const u32_t id) const {
+            for (const i8_t *record = first(); record != nullptr;
+                record = next(record)) {
+                if (internal::log_read<u32_t>(record) == id) {
+                    return record;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /// Table has no different records with same id
+        constexpr bool valid() const {
+            for (const i8_t *a = first(); a != nullptr; a = next(a)) {
+                for (const i8_t *b = next(a); b != nullptr; b = next(b)) {
+                    if (internal::log_read<u32_t>(a) ==
+                        internal::log_read<u32_t>(b) && !same(a, b)) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /// Decode frame, returns its size or 0 when data is incomplete,
+        /// frame of unknown id is reported and rest of data is dropped
+        word_t decode(const i8_t *data, const word_t size) const {
+            if (size < sizeof(u32_t)) {
+                return 0;
+            }
+
+            const u32_t id = internal::log_read<u32_t>(data);
+            const i8_t *record = find(id);
+
+            if (record == nullptr) {
+                out::send("<unknown log id 0x",
+                    out::make_base(base::hex, id), ">\n");
+                return size;
+            }
+
+            const i8_t *signature = record + sizeof(u32_t);
+            const word_t frame = frame_size(signature, data, size);
+
+            if (frame != 0) {
+                send_text(signature, data + sizeof(u32_t));
+            }
+
+            return frame;
+        }
+    private:
+        static constexpr const i8_t *skip(const i8_t *string) {
+            while (*string != '\0') {
+                string++;
+            }
+
+            return string + 1;
+        }
+
+        static constexpr bool same(const i8_t *a, const i8_t *b) {
+            const i8_t *end = skip(skip(a + sizeof(u32_t)));
+
+            for (a += sizeof(u32_t), b += sizeof(u32_t); a != end; a++, b++) {
+                if (*a != *b) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        constexpr const i8_t *first() const {
+            return size_ > sizeof(u32_t) ? table_ : nullptr;
+        }
+
+        /// Records are aligned to four bytes of table
+        constexpr const i8_t *next(const i8_t *record) const {
+            const word_t end = skip(skip(record + sizeof(u32_t))) - table_;
+            const word_t at = (end + 3) & ~static_cast<word_t>(3);
+
+            return at + sizeof(u32_t) < size_ ? table_ + at : nullptr;
+        }
+
+        static constexpr word_t frame_size(const i8_t *signature,
+            const i8_t *data, const word_t size) {
+            word_t at = sizeof(u32_t);
+
+            for (; *signature != '\0'; signature++) {
+                word_t arg = internal::log_code_size(*signature);
+
+                if (*signature == 's' && at < size) {
+                    arg += static_cast<u8_t>(data[at]);
+                }
+
+                if (at + arg > size) {
+                    return 0;
+                }
+
+                at += arg;
+            }
+
+            return at;
+        }
+
+        static void send_text(const i8_t *signature, const i8_t *args) {
+            const i8_t *format = skip(signature);
+            const i8_t *text = format;
+
+            while (*format != '\0') {
+                const bool escape = (*format == '{' || *format == '}') &&
+                    format[1] == *format;
+
+                if (*format != '{' && !escape) {
+                    format++;
+                    continue;
+                }
+
+                internal::send_block<Outer>(text, format - text);
+
+                if (escape) {
+                    text = format + 1;
+                    format += 2;
+                    continue;
+                }
+
+                base arg_base = base::dec;
+                for (; *format != '\0' && *format != '}'; format++) {
+                    arg_base = spec_base(*format, arg_base);
+                }
+
+                if (*format == '}') {
+                    format++;
+                }
+
+                text = format;
+                args = send_arg(*signature++, arg_base, args);
+            }
+
+            internal::send_block<Outer>(text, format - text);
+        }
+
+        static constexpr base spec_base(const i8_t spec, const base value) {
+            switch (spec) {
+                case 'x':
+                    return base::hex;
+                case 'o':
+                    return base::oct;
+                case 'b':
+                    return base::bin;
+                default:
+                    return value;
+            }
+        }
+
+        static const i8_t *send_arg(const i8_t code, const base arg_base,
+            const i8_t *arg) {
+            using internal::log_read;
+
+            switch (code) {
+                case 'c':
+                    out::send(*arg);
+                    break;
+                case 'B':
+                    out::send(log_read<u8_t>(arg), arg_base);
+                    break;
+                case 'h':
+                    out::send(log_read<i16_t>(arg), arg_base);
+                    break;
+                case 'H':
+                    out::send(log_read<u16_t>(arg), arg_base);
+                    break;
+                case 'i':
+                    out::send(log_read<i32_t>(arg), arg_base);
+                    break;
+                case 'I':
+                    out::send(log_read<u32_t>(arg), arg_base);
+                    break;
+                case 'q':
+                    out::send(log_read<i64_t>(arg), arg_base);
+                    break;
+                case 'Q':
+                    out::send(log_read<u64_t>(arg), arg_base);
+                    break;
+                case 's':
+                    internal::send_block<Outer>(arg + 1,
+                        static_cast<u8_t>(*arg));
+                    return arg + 1 + static_cast<u8_t>(*arg);
+            }
+
+            return arg + internal::log_code_size(code);
+        }
+
+        const i8_t *table_;
+        word_t size_;
+    };
+} // namespace lp
+
+#endif // LP_CC_LIB_LOG_HH
@@ -0,0 +1,158 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Packed tuple - members stored by descending alignment
+ * @file lp/packed_tuple.hh
+ * @author Boris Vinogradov
+ */
+
+#include <lp/type_list.hh>
+#include <lp/types.hh>
+#include <tuple.hh>
+#include <type_traits.hh>
+#include <utility.hh>
+
+#ifndef LP_CC_LIB_LP_PACKED_TUPLE_HH
+#define LP_CC_LIB_LP_PACKED_TUPLE_HH
+
+namespace lp {
+    /// Packed tuple element - declared index and type
+    template <word_t Index, typename T>
+    struct packed_element {
+        static constexpr const word_t index = Index;
+        using type = T;
+    };
+
+    /// Sort key of packed tuple elements - descending alignment
+    template <typename Element>
+    using packed_key = std::integral_constant<iword_t,
+        -static_cast<iword_t>(alignof(typename Element::type))>;
+
+    /// Packed tuple layout
+    template <typename Elements>
+    struct packed_layout;
+
+    template <typename ...Elements>
+    struct packed_layout<type_list<Elements...>> {
+        using storage_type = std::tuple<typename Elements::type...>;
+
+        /// Declared index of every stored element
+        static constexpr const word_t order[] = {Elements::index..., 0};
+
+        /// Storage position of element with declared index
+        static constexpr word_t position(word_t index) noexcept {
+            word_t pos = 0;
+            while (pos < sizeof...(Elements) && order[pos] != index) {
+                pos++;
+            }
+
+            return pos;
+        }
+
+        /// Make storage from arguments in declared order
+        template <typename Arguments>
+        static constexpr storage_type make(Arguments &&arguments) noexcept {
+            return storage_type(
+                std::get<Elements::index>(std::move(arguments))...);
+        }
+    };
+
+    template <typename ...Elements>
+    constexpr const word_t packed_layout<type_list<Elements...>>::order[];
+
+    template <typename Indexes, typename ...Types>
+    struct packed_layout_for;
+
+    template <word_t ...Index, typename ...Types>
+    struct packed_layout_for<std::index_sequence<Index...>, Types...> {
+        using type = packed_layout<typename type_list<
+            packed_element<Index, Types>...>::template sort<packed_key>>;
+    };
+
+    /// Packed tuple: get<I> uses declared index, storage is sorted
+    template <typename ...Types>
+    class packed_tuple {
+        using layout = typename packed_layout_for<
+            std::index_sequence_for<Types...>, Types...>::type;
+    public:
+        using storage_type = typename layout::storage_type;
+
+        template <word_t I>
+        using element = typename type_list<Types...>::template get<I>;
+
+        static constexpr const word_t size = sizeof...(Types);
+
+        constexpr packed_tuple() noexcept
+            : storage_{} {}
+
+        explicit constexpr packed_tuple(const Types &...elements) noexcept
+            : storage_{layout::make(std::forward_as_tuple(elements...))} {}
+
+        template <typename ...UTypes, typename = std::enable_if_t<
+            std::and_pred<std::is_convertible<UTypes, Types>...>::value>>
+        explicit constexpr packed_tuple(UTypes &&...elements) noexcept
+            : storage_{layout::make(std::forward_as_tuple(
+                std::forward<UTypes>(elements)...))} {}
+
+        template <word_t I>
+        constexpr element<I> & get() noexcept {
+            return std::get<layout::position(I)>(storage_);
+        }
+
+        template <word_t I>
+        constexpr const element<I> & get() const noexcept {
+            return std::get<layout::position(I)>(storage_);
+        }
+
+        constexpr const storage_type & storage() const noexcept {
+            return storage_;
+        }
+    private:
+        storage_type storage_;
+    };
+
+    /// Getting a packed tuple element by declared index
+    template <word_t I, typename ...Types>
+    constexpr auto & get(packed_tuple<Types...> &tuple) noexcept {
+        return tuple.template get<I>();
+    }
+
+    template <word_t I, typename ...Types>
+    constexpr const auto & get(const packed_tuple<Types...> &tuple) noexcept {
+        return tuple.template get<I>();
+    }
+
+    /// Compare packed tuples with equal types
+    template <typename ...Types>
+    constexpr bool operator == (const packed_tuple<Types...> &t,
+        const packed_tuple<Types...> &u) noexcept {
+        return t.storage() == u.storage();
+    }
+
+    template <typename ...Types>
+    constexpr bool operator != (const packed_tuple<Types...> &t,
+        const packed_tuple<Types...> &u) noexcept {
+        return !(t == u);
+    }
+
+    /// Make packed tuple from args
+    template <typename ...Types>
+    constexpr auto make_packed_tuple(Types &&...args) noexcept {
+        return packed_tuple<std::decay_t<Types>...>(
+            std::forward<Types>(args)...);
+    }
+} // namespace lp
+
+#endif // LP_CC_LIB_LP_PACKED_TUPLE_HH
@@ -0,0 +1,215 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Structure of arrays - one contiguous column per element type
+ * @file lp/soa_array.hh
+ * @author Boris Vinogradov
+ */
+
+#include <lp/types.hh>
+#include <tuple.hh>
+#include <type_traits.hh>
+#include <utility.hh>
+
+#ifndef LP_CC_LIB_LP_SOA_ARRAY_HH
+#define LP_CC_LIB_LP_SOA_ARRAY_HH
+
+namespace lp {
+    /// Contiguous range of column elements
+    template <typename T>
+    class column_view {
+    public:
+        constexpr column_view(T *first, word_t size) noexcept
+            : first_{first}, size_{size} {}
+
+        constexpr T * begin() const noexcept {
+            return first_;
+        }
+
+        constexpr T * end() const noexcept {
+            return first_ + size_;
+        }
+
+        constexpr T * data() const noexcept {
+            return first_;
+        }
+
+        constexpr word_t size() const noexcept {
+            return size_;
+        }
+
+        constexpr T & operator [] (word_t index) const noexcept {
+            return first_[index];
+        }
+    private:
+        T *first_;
+        word_t size_;
+    };
+
+    namespace internal {
+        /// Column of N elements
+        template <typename T, word_t N>
+        struct soa_column {
+            T data[N];
+        };
+
+        /// Columns of all element types, rows are accessed by references
+        template <word_t N, typename ...Types>
+        class soa_storage {
+            static_assert(sizeof...(Types) > 0,
+                "structure of arrays has at least one column");
+        public:
+            template <word_t I>
+            using element = std::tuple_element_t<I, std::tuple<Types...>>;
+
+            using row_type = std::tuple<Types &...>;
+            using const_row_type = std::tuple<const Types &...>;
+
+            static constexpr const word_t capacity = N;
+
+            constexpr soa_storage() noexcept
+                : columns_{} {}
+        protected:
+            template <word_t I>
+            constexpr element<I> * column_data() noexcept {
+                return std::get<I>(columns_).data;
+            }
+
+            template <word_t I>
+            constexpr const element<I> * column_data() const noexcept {
+                return std::get<I>(columns_).data;
+            }
+
+            constexpr row_type row_at(word_t index) noexcept {
+                return row_h(*this, index, std::index_sequence_for<Types...>{});
+            }
+
+            constexpr const_row_type row_at(word_t index) const noexcept {
+                return row_h(*this, index, std::index_sequence_for<Types...>{});
+            }
+        private:
+            template <typename Storage, word_t ...Index>
+            static constexpr auto row_h(Storage &storage, word_t index,
+                std::index_sequence<Index...>) noexcept {
+                return std::tie(
+                    std::get<Index>(storage.columns_).data[index]...);
+            }
+
+            std::tuple<soa_column<Types, N>...> columns_;
+        };
+    } // namespace internal
+
+    /// Structure of arrays with N rows
+    template <word_t N, typename ...Types>
+    class soa_array : public internal::soa_storage<N, Types...> {
+        using storage = internal::soa_storage<N, Types...>;
+    public:
+        using typename storage::row_type;
+        using typename storage::const_row_type;
+
+        static constexpr word_t size() noexcept {
+            return N;
+        }
+
+        /// Column of element I, contiguous N elements
+        template <word_t I>
+        constexpr auto column() noexcept {
+            return column_view<typename storage::template element<I>>(
+                storage::template column_data<I>(), N);
+        }
+
+        template <word_t I>
+        constexpr auto column() const noexcept {
+            return column_view<const typename storage::template element<I>>(
+                storage::template column_data<I>(), N);
+        }
+
+        /// Row view - tuple of references to row elements
+        constexpr row_type operator [] (word_t index) noexcept {
+            return storage::row_at(index);
+        }
+
+        constexpr const_row_type operator [] (word_t index) const noexcept {
+            return storage::row_at(index);
+        }
+    };
+
+    /// Structure of arrays with variable row count up to capacity N
+    template <word_t N, typename ...Types>
+    class soa_vector : public internal::soa_storage<N, Types...> {
+        using storage = internal::soa_storage<N, Types...>;
+    public:
+        using typename storage::row_type;
+        using typename storage::const_row_type;
+
+        constexpr soa_vector() noexcept
+            : size_{0} {}
+
+        constexpr word_t size() const noexcept {
+            return size_;
+        }
+
+        constexpr bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        constexpr bool full() const noexcept {
+            return size_ == N;
+        }
+
+        /// Column of element I, contiguous size() elements
+        template <word_t I>
+        constexpr auto column() noexcept {
+            return column_view<typename storage::template element<I>>(
+                storage::template column_data<I>(), size_);
+        }
+
+        template <word_t I>
+        constexpr auto column() const noexcept {
+            return column_view<const typename storage::template element<I>>(
+                storage::template column_data<I>(), size_);
+        }
+
+        /// Row view - tuple of references to row elements
+        constexpr row_type operator [] (word_t index) noexcept {
+            return storage::row_at(index);
+        }
+
+        constexpr const_row_type operator [] (word_t index) const noexcept {
+            return storage::row_at(index);
+        }
+
+        /// Append row, vector must not be full
+        template <typename ...UTypes, typename = std::enable_if_t<
+            sizeof...(UTypes) == sizeof...(Types)>>
+        constexpr void push_back(UTypes &&...elements) noexcept {
+            storage::row_at(size_++) =
+                std::forward_as_tuple(std::forward<UTypes>(elements)...);
+        }
+
+        /// Remove last row, vector must not be empty
+        constexpr void pop_back() noexcept {
+            size_--;
+        }
+
+        constexpr void clear() noexcept {
+            size_ = 0;
+        }
+    private:
+        word_t size_;
+    };
+} // namespace lp
+
+#endif // LP_CC_LIB_LP_SOA_ARRAY_HH
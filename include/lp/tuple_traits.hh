@@ -24,18 +24,158 @@
 #define LP_CC_LIB_LP_TUPLE_TRAITS_HH
 
 namespace lp {
-    /// Append element to tuple
-    template <typename ...T_types, typename ...Types>
+    namespace internal {
+        /// Tuple extended with elements, defined for tuples only
+        template <typename Tuple, typename ...Types>
+        struct tuple_extend_types;
+
+        template <typename ...T_types, typename ...Types>
+        struct tuple_extend_types<std::tuple<T_types...>, Types...> {
+            using append = std::tuple<T_types..., Types...>;
+            using insert = std::tuple<Types..., T_types...>;
+            using indexes = std::index_sequence_for<T_types...>;
+        };
+
+        template <typename Tuple, typename ...Types>
+        using tuple_extend_for = tuple_extend_types<
+            std::remove_cv_t<std::remove_reference_t<Tuple>>,
+            std::special_decay_t<Types>...>;
+
+        /// Build extended tuple, every element is forwarded once
+        template <typename Ret, typename Indexes>
+        struct tuple_extend;
+
+        template <typename Ret, std::size_t ...Index>
+        struct tuple_extend<Ret, std::index_sequence<Index...>> {
+            template <typename Tuple, typename ...Types>
+            static constexpr Ret append(Tuple &&tuple, Types &&...ts)
+                noexcept {
+                return Ret(std::get<Index>(std::forward<Tuple>(tuple))...,
+                    std::forward<Types>(ts)...);
+            }
+
+            template <typename Tuple, typename ...Types>
+            static constexpr Ret insert(Tuple &&tuple, Types &&...ts)
+                noexcept {
+                return Ret(std::forward<Types>(ts)...,
+                    std::get<Index>(std::forward<Tuple>(tuple))...);
+            }
+        };
+
+        /// Deferred construction, converts to T built from arguments
+        template <typename T, typename ...Args>
+        class emplace_h {
+            template <std::size_t ...Index>
+            constexpr T make(std::index_sequence<Index...>) const noexcept {
+                return T(std::forward<Args>(std::get<Index>(args_))...);
+            }
+        public:
+            explicit constexpr emplace_h(Args &&...args) noexcept
+                : args_(std::forward<Args>(args)...) {}
+
+            constexpr operator T() const noexcept {
+                return make(std::index_sequence_for<Args...>{});
+            }
+        private:
+            std::tuple<Args &&...> args_;
+        };
+
+        template <typename Tuple>
+        using tuple_indexes_for = std::make_index_sequence<std::tuple_size<
+            std::remove_reference_t<Tuple>>::value>;
+
+        template <typename Tuple, typename F, std::size_t ...Index>
+        constexpr void
+        for_each_h(Tuple &&tuple, F &f, std::index_sequence<Index...>) {
+            const bool expand[] = {false,
+                (static_cast<void>(
+                    f(std::get<Index>(std::forward<Tuple>(tuple)))), false)...};
+            static_cast<void>(expand);
+        }
+
+        template <typename Tuple, typename F, std::size_t ...Index>
+        constexpr auto
+        transform_h(Tuple &&tuple, F &f, std::index_sequence<Index...>) {
+            return std::tuple<std::decay_t<decltype(
+                f(std::get<Index>(std::forward<Tuple>(tuple))))>...>{
+                    f(std::get<Index>(std::forward<Tuple>(tuple)))...};
+        }
+
+        /// Left fold, unrolled at compile time
+        template <std::size_t Index, std::size_t Size>
+        struct fold_h {
+            template <typename Tuple, typename T, typename F>
+            static constexpr auto apply(Tuple &&tuple, T &&init, F &f) {
+                return fold_h<Index + 1, Size>::apply(
+                    std::forward<Tuple>(tuple),
+                    f(std::forward<T>(init),
+                        std::get<Index>(std::forward<Tuple>(tuple))), f);
+            }
+        };
+
+        template <std::size_t Size>
+        struct fold_h<Size, Size> {
+            template <typename Tuple, typename T, typename F>
+            static constexpr std::decay_t<T>
+            apply(Tuple &&, T &&init, F &) {
+                return std::forward<T>(init);
+            }
+        };
+    } // namespace internal
+
+    /// Append elements to tuple
+    template <typename Tuple, typename ...Types,
+        typename Extend = internal::tuple_extend_for<Tuple, Types...>>
+    static constexpr auto
+    tuple_append(Tuple &&tuple, Types &&...ts) noexcept {
+        return internal::tuple_extend<typename Extend::append,
+            typename Extend::indexes>::append(
+                std::forward<Tuple>(tuple), std::forward<Types>(ts)...);
+    }
+
+    /// Insert elements to tuple
+    template <typename Tuple, typename ...Types,
+        typename Extend = internal::tuple_extend_for<Tuple, Types...>>
     static constexpr auto
-    tuple_append(std::tuple<T_types ...> tuple, Types ...ts) noexcept {
-        return std::tuple_cat(tuple, std::make_tuple(ts...));
+    tuple_insert(Tuple &&tuple, Types &&...ts) noexcept {
+        return internal::tuple_extend<typename Extend::insert,
+            typename Extend::indexes>::insert(
+                std::forward<Tuple>(tuple), std::forward<Types>(ts)...);
     }
 
-    /// Insert element to tuple
-    template <typename ...T_types, typename ...Types>
+    /// Append element constructed in place from arguments
+    template <typename T, typename Tuple, typename ...Args,
+        typename Extend = internal::tuple_extend_types<
+            std::remove_cv_t<std::remove_reference_t<Tuple>>, T>>
     static constexpr auto
-    tuple_insert(std::tuple<T_types ...> tuple, Types ...ts) noexcept {
-        return std::tuple_cat(std::make_tuple(ts...), tuple);
+    tuple_emplace_back(Tuple &&tuple, Args &&...args) noexcept {
+        return internal::tuple_extend<typename Extend::append,
+            typename Extend::indexes>::append(std::forward<Tuple>(tuple),
+                internal::emplace_h<T, Args...>(std::forward<Args>(args)...));
+    }
+
+    /// Call function for every tuple element in order
+    template <typename Tuple, typename F>
+    constexpr F tuple_for_each(Tuple &&tuple, F f) {
+        internal::for_each_h(std::forward<Tuple>(tuple), f,
+            internal::tuple_indexes_for<Tuple>{});
+
+        return f;
+    }
+
+    /// Tuple of function results for every tuple element, called in order
+    template <typename Tuple, typename F>
+    constexpr auto tuple_transform(Tuple &&tuple, F f) {
+        return internal::transform_h(std::forward<Tuple>(tuple), f,
+            internal::tuple_indexes_for<Tuple>{});
+    }
+
+    /// Left fold of tuple elements: f(...f(f(init, e0), e1)..., eN)
+    template <typename Tuple, typename T, typename F>
+    constexpr auto tuple_fold(Tuple &&tuple, T &&init, F f) {
+        return internal::fold_h<0, std::tuple_size<
+            std::remove_reference_t<Tuple>>::value>::apply(
+                std::forward<Tuple>(tuple), std::forward<T>(init), f);
     }
 } // namespace lp
 
@@ -103,16 +103,18 @@ namespace lp {
         using type = List;
     };
 
-    template <template <typename> class Predicate, typename List,
+    template <template <typename> class Predicate, typename ...Results,
         typename Type, typename ...Types>
-    struct conditional_append<Predicate, List, Type, Types...> {
-        using type = std::conditional_t<
-            Predicate<Type>::value,
-            typename conditional_append<
-                Predicate,
-                typename List::template append<Type>, Types...>::type,
-            typename conditional_append<Predicate, List, Types...>::type
-        >;
+    struct conditional_append<Predicate, type_list<Results...>,
+        Type, Types...> {
+        using type = typename conditional_append<
+            Predicate,
+            std::conditional_t<
+                Predicate<Type>::value,
+                type_list<Results..., Type>,
+                type_list<Results...>
+            >,
+            Types...>::type;
     };
 
     /// Remove matched from types and pack to type_list
@@ -136,11 +138,93 @@ namespace lp {
         using type = List;
     };
 
-    template <typename List, typename Type, typename ...Types>
-    struct reverse_insert<List, Type, Types...> {
+    template <typename ...Results, typename Type, typename ...Types>
+    struct reverse_insert<type_list<Results...>, Type, Types...> {
         using type = typename reverse_insert<
-            typename List::template insert<Type>,
-            Types...>::type;
+            type_list<Type, Results...>, Types...>::type;
+    };
+
+    /// Split type_list: move first N types from Right list to Left list
+    template <word_t N, typename Left, typename Right, bool = N == 0>
+    struct split_items;
+
+    template <word_t N, typename ...Lefts, typename Type, typename ...Rights>
+    struct split_items<N, type_list<Lefts...>, type_list<Type, Rights...>,
+        false> {
+        using type = typename split_items<N - 1,
+            type_list<Lefts..., Type>, type_list<Rights...>>::type;
+    };
+
+    template <word_t N, typename Left, typename Right>
+    struct split_items<N, Left, Right, true> {
+        using first = Left;
+        using second = Right;
+        using type = split_items;
+    };
+
+    /// Merge two sorted type_list by key, equal keys keep left first
+    template <template <typename> class Key,
+        typename Result, typename List1, typename List2>
+    struct merge_sorted;
+
+    template <template <typename> class Key, typename Result,
+        typename List1, typename List2, bool Take_right>
+    struct merge_step;
+
+    template <template <typename> class Key, typename ...Results,
+        typename ...Types2>
+    struct merge_sorted<Key, type_list<Results...>,
+        type_list<>, type_list<Types2...>> {
+        using type = type_list<Results..., Types2...>;
+    };
+
+    template <template <typename> class Key, typename ...Results,
+        typename Type1, typename ...Types1>
+    struct merge_sorted<Key, type_list<Results...>,
+        type_list<Type1, Types1...>, type_list<>> {
+        using type = type_list<Results..., Type1, Types1...>;
+    };
+
+    template <template <typename> class Key, typename Result,
+        typename Type1, typename ...Types1, typename Type2, typename ...Types2>
+    struct merge_sorted<Key, Result,
+        type_list<Type1, Types1...>, type_list<Type2, Types2...>> {
+        using type = typename merge_step<Key, Result,
+            type_list<Type1, Types1...>, type_list<Type2, Types2...>,
+            (Key<Type2>::value < Key<Type1>::value)>::type;
+    };
+
+    template <template <typename> class Key, typename ...Results,
+        typename Type1, typename ...Types1, typename List2>
+    struct merge_step<Key, type_list<Results...>,
+        type_list<Type1, Types1...>, List2, false> {
+        using type = typename merge_sorted<Key,
+            type_list<Results..., Type1>, type_list<Types1...>, List2>::type;
+    };
+
+    template <template <typename> class Key, typename ...Results,
+        typename List1, typename Type2, typename ...Types2>
+    struct merge_step<Key, type_list<Results...>,
+        List1, type_list<Type2, Types2...>, true> {
+        using type = typename merge_sorted<Key,
+            type_list<Results..., Type2>, List1, type_list<Types2...>>::type;
+    };
+
+    /// Stable merge sort of type_list by ascending Key<T>::value
+    template <template <typename> class Key, typename List>
+    struct merge_sort {
+        using type = List;
+    };
+
+    template <template <typename> class Key,
+        typename Type1, typename Type2, typename ...Types>
+    struct merge_sort<Key, type_list<Type1, Type2, Types...>> {
+        using halves = typename split_items<(sizeof...(Types) + 2) / 2,
+            type_list<>, type_list<Type1, Type2, Types...>>::type;
+
+        using type = typename merge_sorted<Key, type_list<>,
+            typename merge_sort<Key, typename halves::first>::type,
+            typename merge_sort<Key, typename halves::second>::type>::type;
     };
 
     /// Impementation of type_list
@@ -180,6 +264,9 @@ namespace lp {
 
         using reverse = typename reverse_insert<type_list<>, Types...>::type;
 
+        template <template <typename> class Key>
+        using sort = typename merge_sort<Key, type_list<Types...>>::type;
+
         static constexpr const word_t size = sizeof...(Types);
     };
 } // namespace lp
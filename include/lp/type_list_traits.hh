@@ -18,6 +18,7 @@
  * @author Boris Vinogradov
  */
 
+#include <lp/associate_type.hh>
 #include <lp/type_list.hh>
 
 #include <type_traits.hh>
@@ -106,6 +107,211 @@ namespace lp {
 
     template <template <typename> class Functor, typename ...Types>
     using for_each_t = typename for_each<Functor, Types...>::type;
+
+    /// Type tag - pass type to runtime functors as value
+    template <typename T>
+    struct tag {
+        using type = T;
+    };
+
+    /// For each type at runtime - call functor with tag of every type
+    template <typename List>
+    struct for_each_type_h;
+
+    template <typename ...Types>
+    struct for_each_type_h<type_list<Types...>> {
+        template <typename Functor>
+        static constexpr void apply(Functor &functor) {
+            const bool expand[] = {false,
+                (static_cast<void>(functor(tag<Types>{})), false)...};
+            static_cast<void>(expand);
+        }
+
+        template <typename Functor>
+        static constexpr bool apply_while(Functor &functor) {
+            bool next = true;
+            const bool expand[] = {false,
+                (next = next && static_cast<bool>(functor(tag<Types>{})))...};
+            static_cast<void>(expand);
+
+            return next;
+        }
+    };
+
+    template <typename List, typename Functor>
+    constexpr void for_each_type(Functor &&functor) {
+        for_each_type_h<List>::apply(functor);
+    }
+
+    /// For each type while functor returns true, false if stopped early
+    template <typename List, typename Functor>
+    constexpr bool for_each_type_while(Functor &&functor) {
+        return for_each_type_h<List>::apply_while(functor);
+    }
+
+    /// Dispatch runtime index to type - table of functor calls
+    template <typename Functor, typename Result, typename ...Types>
+    struct dispatch_table {
+        template <typename T>
+        static constexpr Result call(Functor &functor) {
+            return functor(tag<T>{});
+        }
+
+        static constexpr Result (*const table[])(Functor &) = {
+            &call<Types>...
+        };
+    };
+
+    template <typename Functor, typename Result, typename ...Types>
+    constexpr Result (*const dispatch_table<Functor, Result, Types...>::
+        table[])(Functor &);
+
+    /// Dispatch runtime index to type - compare chain for short lists,
+    /// direct calls without indirect jump, which is slower than chain of
+    /// compares up to dispatch_chain_limit types
+    template <typename Result, typename ...Types>
+    struct dispatch_chain;
+
+    template <typename Result>
+    struct dispatch_chain<Result> {
+        template <typename Functor>
+        static constexpr Result apply(word_t, Functor &) {
+            return Result();
+        }
+    };
+
+    template <typename Result, typename Type, typename ...Types>
+    struct dispatch_chain<Result, Type, Types...> {
+        template <typename Functor>
+        static constexpr Result apply(word_t index, Functor &functor) {
+            if (index == 0) {
+                return functor(tag<Type>{});
+            }
+
+            return dispatch_chain<Result, Types...>::apply(index - 1, functor);
+        }
+    };
+
+    /// Maximal list size dispatched by compare chain
+    constexpr word_t dispatch_chain_limit = 16;
+
+    template <typename List>
+    struct dispatch_h {
+        static_assert(List::size > 0, "lp::dispatch: empty type_list");
+
+        template <typename Functor>
+        static constexpr void apply(word_t, Functor &) {}
+    };
+
+    template <typename Type, typename ...Types>
+    struct dispatch_h<type_list<Type, Types...>> {
+        template <typename Functor>
+        using result = decltype(std::declval<Functor &>()(tag<Type>{}));
+
+        template <typename Functor>
+        static constexpr result<Functor>
+        apply(word_t index, Functor &functor, std::true_type) {
+            return dispatch_chain<result<Functor>, Type, Types...>::
+                apply(index, functor);
+        }
+
+        template <typename Functor>
+        static constexpr result<Functor>
+        apply(word_t index, Functor &functor, std::false_type) {
+            using table_t =
+                dispatch_table<Functor, result<Functor>, Type, Types...>;
+
+            if (index > sizeof...(Types)) {
+                return result<Functor>();
+            }
+
+            return table_t::table[index](functor);
+        }
+
+        template <typename Functor>
+        static constexpr result<Functor>
+        apply(word_t index, Functor &functor) {
+            using is_short = std::integral_constant<bool,
+                sizeof...(Types) < dispatch_chain_limit>;
+
+            return apply(index, functor, is_short{});
+        }
+    };
+
+    /// Call functor with tag of type at runtime index, lists longer than
+    /// dispatch_chain_limit use function table - O(1) time and code size
+    /// linear to list size. Index out of range returns default result
+    template <typename List, typename Functor>
+    constexpr auto dispatch(word_t index, Functor &&functor) {
+        return dispatch_h<List>::apply(index, functor);
+    }
+
+    /// Sort types by ascending constexpr key - Key<T>::value
+    template <template <typename> class Key, typename ...Types>
+    struct sort {
+        using type = typename type_list<Types...>::template sort<Key>;
+    };
+
+    template <template <typename> class Key, typename ...Types>
+    struct sort<Key, type_list<Types...>> {
+        using type = typename sort<Key, Types...>::type;
+    };
+
+    template <template <typename> class Key, typename ...Types>
+    using sort_t = typename sort<Key, Types...>::type;
+
+    /// Stable partition - matched types first, order inside parts is kept
+    template <template <typename> class Predicate, typename ...Types>
+    struct stable_partition {
+        using matched =
+            typename type_list<Types...>::template filter<Predicate>;
+        using unmatched =
+            typename type_list<Types...>::template remove<Predicate>;
+        using type = join<matched, unmatched>;
+    };
+
+    template <template <typename> class Predicate, typename ...Types>
+    struct stable_partition<Predicate, type_list<Types...>>
+        : stable_partition<Predicate, Types...> {};
+
+    template <template <typename> class Predicate, typename ...Types>
+    using stable_partition_t =
+        typename stable_partition<Predicate, Types...>::type;
+
+    /// Group types by key - Key<T>::type, groups follow first key appearance
+    template <template <typename> class Key, typename ...Types>
+    struct group_by {
+        template <typename Key_type>
+        struct group {
+            template <typename T>
+            using same_key = std::is_same<Key_type, typename Key<T>::type>;
+
+            using type =
+                typename type_list<Types...>::template filter<same_key>;
+        };
+
+        template <typename Keys>
+        struct groups;
+
+        template <typename ...Keys>
+        struct groups<type_list<Keys...>> {
+            using type = type_list<typename group<Keys>::type...>;
+        };
+
+        using keys = unique_t<for_each_t<Key, Types...>>;
+        using type = typename groups<keys>::type;
+    };
+
+    template <template <typename> class Key, typename ...Types>
+    struct group_by<Key, type_list<Types...>> : group_by<Key, Types...> {};
+
+    template <template <typename> class Key, typename ...Types>
+    using group_by_t = typename group_by<Key, Types...>::type;
+
+    /// Group associate types by their associate type
+    template <typename ...Types>
+    using group_by_assoc_t =
+        typename group_by<extract_assoc_type, Types...>::type;
 } // namespace lp
 
 #endif // LP_CC_LIB_LP_TYPE_LIST_TRAITS_HH
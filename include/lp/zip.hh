@@ -0,0 +1,162 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Lockstep iteration over several ranges
+ * @file lp/zip.hh
+ * @author Boris Vinogradov
+ */
+
+#include <lp/types.hh>
+#include <tuple.hh>
+#include <type_traits.hh>
+#include <utility.hh>
+
+#ifndef LP_CC_LIB_LP_ZIP_HH
+#define LP_CC_LIB_LP_ZIP_HH
+
+namespace lp {
+    namespace internal {
+        /// First element and size of array or range with begin()/size()
+        template <typename T, word_t N>
+        constexpr T * range_begin(T (&range)[N]) noexcept {
+            return range;
+        }
+
+        template <typename Range>
+        constexpr auto range_begin(Range &range) noexcept
+            -> decltype(range.begin()) {
+            return range.begin();
+        }
+
+        template <typename T, word_t N>
+        constexpr word_t range_size(T (&)[N]) noexcept {
+            return N;
+        }
+
+        template <typename Range>
+        constexpr auto range_size(Range &range) noexcept
+            -> decltype(range.size()) {
+            return range.size();
+        }
+
+        template <typename Range>
+        using range_iterator =
+            decltype(range_begin(std::declval<Range &>()));
+    } // namespace internal
+
+    /// Iterator over ranges in lockstep, dereference gives tuple of
+    /// element references, only the first iterator is compared
+    template <typename ...Iterators>
+    class zip_iterator {
+    public:
+        using reference = std::tuple<decltype(*std::declval<Iterators>())...>;
+
+        explicit constexpr zip_iterator(Iterators ...its) noexcept
+            : its_{its...} {}
+
+        constexpr reference operator * () const noexcept {
+            return deref(std::index_sequence_for<Iterators...>{});
+        }
+
+        constexpr zip_iterator & operator ++ () noexcept {
+            advance(1, std::index_sequence_for<Iterators...>{});
+
+            return *this;
+        }
+
+        constexpr zip_iterator operator ++ (int) noexcept {
+            auto it = *this;
+            ++*this;
+
+            return it;
+        }
+
+        constexpr zip_iterator operator + (word_t count) const noexcept {
+            auto it = *this;
+            it.advance(count, std::index_sequence_for<Iterators...>{});
+
+            return it;
+        }
+
+        constexpr bool operator == (const zip_iterator &it) const noexcept {
+            return std::get<0>(its_) == std::get<0>(it.its_);
+        }
+
+        constexpr bool operator != (const zip_iterator &it) const noexcept {
+            return !(*this == it);
+        }
+    private:
+        template <word_t ...Index>
+        constexpr reference deref(std::index_sequence<Index...>) const
+            noexcept {
+            return std::forward_as_tuple(*std::get<Index>(its_)...);
+        }
+
+        template <word_t ...Index>
+        constexpr void advance(word_t count, std::index_sequence<Index...>)
+            noexcept {
+            const bool expand[] = {false,
+                (std::get<Index>(its_) += count, false)...};
+            static_cast<void>(expand);
+        }
+
+        std::tuple<Iterators...> its_;
+    };
+
+    /// Ranges iterated in lockstep up to the shortest one
+    template <typename ...Iterators>
+    class zip_range {
+    public:
+        using iterator = zip_iterator<Iterators...>;
+
+        constexpr zip_range(iterator first, word_t size) noexcept
+            : first_{first}, size_{size} {}
+
+        constexpr iterator begin() const noexcept {
+            return first_;
+        }
+
+        constexpr iterator end() const noexcept {
+            return first_ + size_;
+        }
+
+        constexpr word_t size() const noexcept {
+            return size_;
+        }
+    private:
+        iterator first_;
+        word_t size_;
+    };
+
+    /// Zip arrays and ranges, no data is copied
+    template <typename ...Ranges>
+    constexpr auto zip(Ranges &&...ranges) noexcept {
+        static_assert(sizeof...(Ranges) > 0, "zip at least one range");
+
+        const word_t sizes[] = {
+            static_cast<word_t>(internal::range_size(ranges))...};
+        word_t size = sizes[0];
+
+        for (auto s : sizes) {
+            size = s < size ? s : size;
+        }
+
+        return zip_range<internal::range_iterator<Ranges>...>(
+            zip_iterator<internal::range_iterator<Ranges>...>(
+                internal::range_begin(ranges)...), size);
+    }
+} // namespace lp
+
+#endif // LP_CC_LIB_LP_ZIP_HH
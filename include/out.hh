@@ -21,107 +21,1187 @@
 #ifndef LP_CC_LIB_OUT_HH
 #define LP_CC_LIB_OUT_HH
 
-#include <types.hh>
+#include <lp/types.hh>
+#include <type_traits.hh>
+#include <utility.hh>
+#include <lp/type_list.hh>
+
+/// "text" as lp::literal in standard C++14 - symbols of up to 128 are
+/// indexed and cut to size of string, LP_CC_LIB_LIT("x = {}\n") is same
+/// as "x = {}\n"_lit
+#define LP_CC_LIB_LIT(string) ::lp::internal::literal_of_t< \
+    sizeof(string) - 1, LP_CC_LIB_LIT_128(string)>{}
+
+#define LP_CC_LIB_LIT_8(string, at) \
+    ::lp::internal::literal_at(string, (at)), \
+    ::lp::internal::literal_at(string, (at) + 1), \
+    ::lp::internal::literal_at(string, (at) + 2), \
+    ::lp::internal::literal_at(string, (at) + 3), \
+    ::lp::internal::literal_at(string, (at) + 4), \
+    ::lp::internal::literal_at(string, (at) + 5), \
+    ::lp::internal::literal_at(string, (at) + 6), \
+    ::lp::internal::literal_at(string, (at) + 7)
+
+#define LP_CC_LIB_LIT_32(string, at) \
+    LP_CC_LIB_LIT_8(string, (at)), LP_CC_LIB_LIT_8(string, (at) + 8), \
+    LP_CC_LIB_LIT_8(string, (at) + 16), LP_CC_LIB_LIT_8(string, (at) + 24)
+
+#define LP_CC_LIB_LIT_128(string) \
+    LP_CC_LIB_LIT_32(string, 0), LP_CC_LIB_LIT_32(string, 32), \
+    LP_CC_LIB_LIT_32(string, 64), LP_CC_LIB_LIT_32(string, 96)
 
 namespace lp {
+    /// Base of number output
+    enum struct number_base : u8_t {
+        bin = 2,
+        oct = 8,
+        dec = 10,
+        hex = 16,
+        alpha = 36
+    };
+
+    /// Number with its output base
+    template <typename T>
+    struct to_base {
+        const number_base bs;
+        const T t;
+    };
+
+    template <typename T>
+    constexpr to_base<T> make_base(const number_base bs, const T t) {
+        return to_base<T>{bs, t};
+    }
+
+    namespace internal {
+        /// Digit tables for number formatting
+        template <typename T = void>
+        struct digit_tables {
+            /// Two decimal digits of 0 - 99
+            static constexpr const i8_t pairs[201] =
+                "0001020304050607080910111213141516171819"
+                "2021222324252627282930313233343536373839"
+                "4041424344454647484950515253545556575859"
+                "6061626364656667686970717273747576777879"
+                "8081828384858687888990919293949596979899";
+
+            /// Digits of power of two bases up to 16
+            static constexpr const i8_t nibbles[17] = "0123456789abcdef";
+
+            /// Lower bounds of decimal digit counts, zero for one digit
+            static constexpr const u32_t bounds[10] = {0, 10, 100, 1000,
+                10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+        };
+
+        template <typename T>
+        constexpr const i8_t digit_tables<T>::pairs[];
+
+        template <typename T>
+        constexpr const i8_t digit_tables<T>::nibbles[];
+
+        template <typename T>
+        constexpr const u32_t digit_tables<T>::bounds[];
+
+        /// Quotient of division by 100, exact for all u32_t numbers
+        constexpr u32_t div_100(const u32_t number) {
+            return static_cast<u32_t>(
+                (static_cast<u64_t>(number) * 0x51eb851full) >> 37);
+        }
+
+        /// Quotient of division by 10^9, native 64 bit division
+        constexpr u64_t div_1e9(const u64_t number, std::true_type) {
+            return number / 1000000000;
+        }
+
+        /// Quotient of division by 10^9 as high half of reciprocal
+        /// product, built from 32 bit products, so 32 bit targets do not
+        /// call 64 bit division of runtime library
+        constexpr u64_t div_1e9(const u64_t number, std::false_type) {
+            constexpr u32_t m_high = 0x0044b82f; // 2^75 / 5^9, rounded up
+            constexpr u32_t m_low = 0xa09b5a53;
+
+            const u64_t shifted = number >> 9; // 10^9 = 2^9 * 5^9
+            const u32_t high = static_cast<u32_t>(shifted >> 32);
+            const u32_t low = static_cast<u32_t>(shifted);
+
+            const u64_t middle = static_cast<u64_t>(high) * m_low +
+                static_cast<u64_t>(low) * m_high +
+                (static_cast<u64_t>(low) * m_low >> 32);
+
+            return (static_cast<u64_t>(high) * m_high + (middle >> 32)) >> 11;
+        }
+
+        constexpr u64_t div_1e9(const u64_t number) {
+            return div_1e9(number, std::integral_constant<bool,
+                sizeof(word_t) >= sizeof(u64_t)>{});
+        }
+
+        /// Count of decimal digits, estimated from bit count as
+        /// log10(2) ~ 1233 / 4096 and corrected by one compare
+        constexpr u8_t dec_count(const u32_t number) {
+            const u32_t estimate =
+                (32 - __builtin_clz(number | 1)) * 1233 >> 12;
+
+            return static_cast<u8_t>(estimate + 1 -
+                (number < digit_tables<>::bounds[estimate]));
+        }
+
+        /// Number formatting to the end of buffer, every formatter puts
+        /// '\0' to end and returns pointer to the first digit
+        struct number_format {
+            /// Decimal digits before end, two digits per step with
+            /// reciprocal multiply instead of division
+            static constexpr i8_t * dec_digits(i8_t *end, u32_t number) {
+                while (number >= 100) {
+                    const u32_t quotient = div_100(number);
+                    const u32_t pair = (number - quotient * 100) * 2;
+
+                    end -= 2;
+                    end[0] = digit_tables<>::pairs[pair];
+                    end[1] = digit_tables<>::pairs[pair + 1];
+                    number = quotient;
+                }
+
+                if (number >= 10) {
+                    end -= 2;
+                    end[0] = digit_tables<>::pairs[number * 2];
+                    end[1] = digit_tables<>::pairs[number * 2 + 1];
+                } else {
+                    *--end = static_cast<i8_t>('0' + number);
+                }
+
+                return end;
+            }
+
+            /// Exactly Digits decimal digits before end, zero padded
+            template <u8_t Digits>
+            static constexpr i8_t * dec_fixed(i8_t *end, u32_t number) {
+                for (u8_t i = 0; i < Digits / 2; i++) {
+                    const u32_t quotient = div_100(number);
+                    const u32_t pair = (number - quotient * 100) * 2;
+
+                    end -= 2;
+                    end[0] = digit_tables<>::pairs[pair];
+                    end[1] = digit_tables<>::pairs[pair + 1];
+                    number = quotient;
+                }
+
+                if (Digits % 2 != 0) {
+                    *--end = static_cast<i8_t>('0' + number);
+                }
+
+                return end;
+            }
+
+            /// Decimal
+            static constexpr i8_t * dec(i8_t *end, u32_t number) {
+                *end = '\0';
+
+                return dec_digits(end, number);
+            }
+
+            /// Decimal u64_t - split into 10^9 chunks, formatted as u32_t,
+            /// at most two divisions by 10^9, remainder is 32 bit
+            static constexpr i8_t * dec(i8_t *end, u64_t number) {
+                constexpr u32_t chunk = 1000000000;
+
+                *end = '\0';
+
+                while (number > 0xffffffffull) {
+                    const u64_t quotient = div_1e9(number);
+
+                    end = dec_fixed<9>(end, static_cast<u32_t>(number) -
+                        static_cast<u32_t>(quotient) * chunk);
+                    number = quotient;
+                }
+
+                return dec_digits(end, static_cast<u32_t>(number));
+            }
+
+            /// Power of two base - shifts and digit table
+            template <u8_t Shift, typename T>
+            static constexpr i8_t * pow2(i8_t *end, T number) {
+                *end = '\0';
+
+                constexpr T mask = (T(1) << Shift) - 1;
+
+                do {
+                    *--end = digit_tables<>::nibbles[number & mask];
+                    number >>= Shift;
+                } while (number > 0);
+
+                return end;
+            }
+
+            /// Any base up to 36 - division per digit
+            template <typename T>
+            static constexpr i8_t * any(i8_t *end, T number,
+                const u8_t base) {
+                *end = '\0';
+
+                do {
+                    i8_t dig = number % base;
+                    if (dig > 9)
+                        dig += 0x27;
+                    *--end = dig + '0';
+                    number /= base;
+                } while (number > 0);
+
+                return end;
+            }
+        };
+
+        /// Number in base to the end of buffer, returns pointer to the
+        /// first digit
+        template <typename T>
+        constexpr i8_t * format_number(i8_t *end, const T number,
+            const number_base base) {
+            switch (base) {
+            case number_base::dec:
+                return number_format::dec(end, number);
+            case number_base::hex:
+                return number_format::pow2<4>(end, number);
+            case number_base::oct:
+                return number_format::pow2<3>(end, number);
+            case number_base::bin:
+                return number_format::pow2<1>(end, number);
+            default:
+                return number_format::any(end, number,
+                    static_cast<u8_t>(base));
+            }
+        }
+
+        /// Outer has block send(const i8_t *data, word_t size)
+        struct has_block_send_h {
+            template <typename Outer, typename = decltype(Outer::send(
+                std::declval<const i8_t *>(), std::declval<word_t>()))>
+            static std::true_type test(int);
+
+            template <typename>
+            static std::false_type test(...);
+        };
+
+        template <typename Outer>
+        using has_block_send = decltype(has_block_send_h::test<Outer>(0));
+
+        /// Outer has flush()
+        struct has_flush_h {
+            template <typename Outer, typename = decltype(Outer::flush())>
+            static std::true_type test(int);
+
+            template <typename>
+            static std::false_type test(...);
+        };
+
+        template <typename Outer>
+        using has_flush = decltype(has_flush_h::test<Outer>(0));
+
+        /// Send block to outer, symbol by symbol without block send
+        template <typename Outer>
+        constexpr void send_block(const i8_t *data, const word_t size,
+            std::true_type) {
+            Outer::send(data, size);
+        }
+
+        template <typename Outer>
+        constexpr void send_block(const i8_t *data, word_t size,
+            std::false_type) {
+            while (size-- > 0) {
+                Outer::send(*data++);
+            }
+        }
+
+        template <typename Outer>
+        constexpr void send_block(const i8_t *data, const word_t size) {
+            send_block<Outer>(data, size, has_block_send<Outer>{});
+        }
+
+        /// Size of string in array, up to the first '\0' and at most
+        /// limit symbols
+        constexpr word_t string_size(const i8_t *string, const word_t limit) {
+            word_t size = 0;
+            while (size < limit && string[size] != '\0') {
+                size++;
+            }
+
+            return size;
+        }
+
+        /// Flush outer if it has flush()
+        template <typename Outer>
+        constexpr void flush(std::true_type) {
+            Outer::flush();
+        }
+
+        template <typename Outer>
+        constexpr void flush(std::false_type) {}
+
+        template <typename Outer>
+        constexpr void flush() {
+            flush<Outer>(has_flush<Outer>{});
+        }
+    } // namespace internal
+
+    /// Compile time string, adjacent literals are merged by lp::out
+    template <i8_t ...Chars>
+    struct literal {
+        static constexpr const i8_t data[sizeof...(Chars) + 1] =
+            {Chars..., '\0'};
+
+        static constexpr word_t size() {
+            return sizeof...(Chars);
+        }
+    };
+
+    template <i8_t ...Chars>
+    constexpr const i8_t literal<Chars...>::data[];
+
+    template <i8_t ...Chars_1, i8_t ...Chars_2>
+    constexpr literal<Chars_1..., Chars_2...>
+    operator + (literal<Chars_1...>, literal<Chars_2...>) {
+        return {};
+    }
+
+    namespace literals {
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wgnu-string-literal-operator-template"
+#elif defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+        /// "text"_lit - literal type of string, GNU extension supported by
+        /// GCC and Clang, LP_CC_LIB_LIT("text") is standard C++14 form
+        template <typename Char, Char ...Chars>
+        constexpr literal<Chars...> operator "" _lit() {
+            return {};
+        }
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+    } // namespace literals
+
+    namespace internal {
+        /// Longest string of LP_CC_LIB_LIT
+        constexpr word_t literal_max_size = 128;
+
+        /// Symbol of string or '\0' past its end
+        template <word_t N>
+        constexpr i8_t literal_at(const i8_t (&string)[N],
+            const word_t index) {
+            return index < N ? string[index] : '\0';
+        }
+
+        /// First symbols of literal, selected by index sequence
+        template <typename Literal, typename Indexes>
+        struct literal_take;
+
+        template <i8_t ...Chars, word_t ...Index>
+        struct literal_take<literal<Chars...>, std::index_sequence<Index...>> {
+            using type = literal<literal<Chars...>::data[Index]...>;
+        };
+
+        template <word_t Size, i8_t ...Chars>
+        struct literal_of {
+            static_assert(Size <= literal_max_size,
+                "LP_CC_LIB_LIT: string is longer than 128 symbols");
+
+            using type = typename literal_take<literal<Chars...>,
+                std::make_index_sequence<Size>>::type;
+        };
+
+        template <word_t Size, i8_t ...Chars>
+        using literal_of_t = typename literal_of<Size, Chars...>::type;
+    } // namespace internal
+
+    namespace internal {
+        /// Token of format string - symbol, field or error, '{{' and
+        /// '}}' are escaped braces
+        struct format_token {
+            enum struct kind : u8_t {
+                end,
+                symbol,
+                field,
+                error
+            };
+
+            kind type;
+            i8_t value; ///< symbol or base spec of field, '\0' for {}
+            word_t next;
+        };
+
+        constexpr bool format_spec(const i8_t symbol) {
+            return symbol == 'x' || symbol == 'o' || symbol == 'b';
+        }
+
+        constexpr number_base format_base(const i8_t spec) {
+            return spec == 'x' ? number_base::hex :
+                spec == 'o' ? number_base::oct : number_base::bin;
+        }
+
+        constexpr format_token format_next(const i8_t *text,
+            const word_t size, const word_t at) {
+            using kind = format_token::kind;
+
+            if (at >= size) {
+                return {kind::end, '\0', at};
+            }
+
+            const i8_t symbol = text[at];
+            const i8_t next = at + 1 < size ? text[at + 1] : '\0';
+
+            if (symbol == '{') {
+                if (next == '{') {
+                    return {kind::symbol, '{', at + 2};
+                }
+
+                if (next == '}') {
+                    return {kind::field, '\0', at + 2};
+                }
+
+                if (format_spec(next) && at + 2 < size &&
+                    text[at + 2] == '}') {
+                    return {kind::field, next, at + 3};
+                }
+
+                return {kind::error, symbol, at + 1};
+            }
+
+            if (symbol == '}') {
+                if (next == '}') {
+                    return {kind::symbol, '}', at + 2};
+                }
+
+                return {kind::error, symbol, at + 1};
+            }
+
+            return {kind::symbol, symbol, at + 1};
+        }
+
+        /// Format string has only symbols, escapes and known fields
+        constexpr bool format_valid(const i8_t *text, const word_t size) {
+            using kind = format_token::kind;
+
+            for (auto token = format_next(text, size, 0);
+                token.type != kind::end;
+                token = format_next(text, size, token.next)) {
+                if (token.type == kind::error) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        constexpr word_t format_fields(const i8_t *text, const word_t size) {
+            using kind = format_token::kind;
+            word_t count = 0;
+
+            for (auto token = format_next(text, size, 0);
+                token.type != kind::end;
+                token = format_next(text, size, token.next)) {
+                count += token.type == kind::field;
+            }
+
+            return count;
+        }
+
+        /// Symbol Index of Segment before field Segment, Index equal to
+        /// segment size gives its size
+        constexpr word_t format_segment_find(const i8_t *text,
+            const word_t size, const word_t segment, const word_t index,
+            i8_t &symbol) {
+            using kind = format_token::kind;
+            word_t field = 0;
+            word_t count = 0;
+
+            for (auto token = format_next(text, size, 0);
+                token.type != kind::end && field <= segment;
+                token = format_next(text, size, token.next)) {
+                if (token.type == kind::field) {
+                    field++;
+                } else if (token.type == kind::symbol && field == segment) {
+                    if (count == index) {
+                        symbol = token.value;
+                    }
+
+                    count++;
+                }
+            }
+
+            return count;
+        }
+
+        constexpr word_t format_segment_size(const i8_t *text,
+            const word_t size, const word_t segment) {
+            i8_t symbol = '\0';
+
+            return format_segment_find(text, size, segment, size, symbol);
+        }
+
+        constexpr i8_t format_segment_symbol(const i8_t *text,
+            const word_t size, const word_t segment, const word_t index) {
+            i8_t symbol = '\0';
+            format_segment_find(text, size, segment, index, symbol);
+
+            return symbol;
+        }
+
+        constexpr i8_t format_field_spec(const i8_t *text,
+            const word_t size, const word_t field) {
+            using kind = format_token::kind;
+            word_t count = 0;
+
+            for (auto token = format_next(text, size, 0);
+                token.type != kind::end;
+                token = format_next(text, size, token.next)) {
+                if (token.type == kind::field && count++ == field) {
+                    return token.value;
+                }
+            }
+
+            return '\0';
+        }
+
+        /// Literal of symbols between fields Segment - 1 and Segment
+        template <typename Format, word_t Segment,
+            typename = std::make_index_sequence<format_segment_size(
+                Format::data, Format::size(), Segment)>>
+        struct format_segment;
+
+        template <typename Format, word_t Segment, word_t ...Index>
+        struct format_segment<Format, Segment, std::index_sequence<Index...>> {
+            using type = literal<format_segment_symbol(Format::data,
+                Format::size(), Segment, Index)...>;
+        };
+
+        /// Field of format string, value is sent as is for {}
+        template <i8_t Spec>
+        struct format_field {
+            template <typename T>
+            static constexpr to_base<std::decay_t<T>> apply(const T &value) {
+                return make_base(format_base(Spec), value);
+            }
+        };
+
+        template <>
+        struct format_field<'\0'> {
+            template <typename T>
+            static constexpr T && apply(T &&value) {
+                return std::forward<T>(value);
+            }
+        };
+
+        /// Format string split to literal segments and fields
+        template <typename Format,
+            typename = std::make_index_sequence<format_fields(
+                Format::data, Format::size())>>
+        struct format_parse;
+
+        template <typename Format, word_t ...Index>
+        struct format_parse<Format, std::index_sequence<Index...>> {
+            static constexpr bool valid =
+                format_valid(Format::data, Format::size());
+
+            using segments = type_list<
+                typename format_segment<Format, Index>::type...,
+                typename format_segment<Format, sizeof...(Index)>::type>;
+
+            using fields = type_list<format_field<format_field_spec(
+                Format::data, Format::size(), Index)>...>;
+        };
+
+        /// Empty segments are not sent
+        template <typename Output>
+        constexpr void format_send_segment(Output &, literal<>) {}
+
+        template <typename Output, i8_t ...Chars>
+        constexpr void format_send_segment(Output &output,
+            literal<Chars...> segment) {
+            output.send(segment);
+        }
+
+        /// Segments and fields are sent in turn
+        template <typename Segments, typename Fields>
+        struct format_send;
+
+        template <typename Segment>
+        struct format_send<type_list<Segment>, type_list<>> {
+            template <typename Output>
+            static constexpr void send(Output &output) {
+                format_send_segment(output, Segment{});
+            }
+        };
+
+        template <typename Segment, typename ...Segments,
+            typename Field, typename ...Fields>
+        struct format_send<type_list<Segment, Segments...>,
+            type_list<Field, Fields...>> {
+            template <typename Output, typename Arg, typename ...Args>
+            static constexpr void send(Output &output, Arg &&arg,
+                Args &&...args) {
+                format_send_segment(output, Segment{});
+                output.send(Field::apply(std::forward<Arg>(arg)));
+                format_send<type_list<Segments...>,
+                    type_list<Fields...>>::send(output,
+                        std::forward<Args>(args)...);
+            }
+        };
+
+        /// Format string checks and send of args
+        template <i8_t ...Chars, typename Output, typename ...Args>
+        constexpr void format(Output &output, literal<Chars...>,
+            Args &&...args) {
+            using parse = format_parse<literal<Chars...>>;
+
+            static_assert(parse::valid, "lp::out: bad format string, "
+                "fields are {}, {x}, {o}, {b}, braces are {{ and }}");
+            static_assert(parse::fields::size == sizeof...(Args),
+                "lp::out: number of format fields and arguments differs");
+
+            format_send<typename parse::segments,
+                typename parse::fields>::send(output,
+                    std::forward<Args>(args)...);
+        }
+    } // namespace internal
+
+    /// Flush policy - buffer is sent when it is full or on flush()
+    struct flush_on_full {
+        static constexpr bool flush_after(const i8_t) {
+            return false;
+        }
+    };
+
+    /// Flush policy - buffer is also sent after every new line
+    struct flush_on_newline {
+        static constexpr bool flush_after(const i8_t symbol) {
+            return symbol == '\n';
+        }
+    };
+
+    /// Buffered outer - collects symbols and sends them to Outer as
+    /// blocks, Outer block send is used when it has one
+    template <typename Outer, word_t Size = 64,
+        typename Flush = flush_on_newline>
+    class buffered_outer {
+        static_assert(Size > 0, "buffer has at least one symbol");
+    public:
+        using outer = Outer;
+
+        static void send(const i8_t symbol) {
+            buffer_[size_++] = symbol;
+
+            if (size_ == Size || Flush::flush_after(symbol)) {
+                flush();
+            }
+        }
+
+        static void send(const i8_t *data, word_t size) {
+            while (size > 0) {
+                const word_t free = Size - size_;
+                word_t count = size < free ? size : free;
+                bool full = count == free;
+                i8_t *out = buffer_ + size_;
+
+                for (word_t i = 0; i < count; i++) {
+                    out[i] = data[i];
+
+                    if (Flush::flush_after(data[i])) {
+                        count = i + 1;
+                        full = true;
+                        break;
+                    }
+                }
+
+                size_ += count;
+                data += count;
+                size -= count;
+
+                if (full) {
+                    flush();
+                }
+            }
+        }
+
+        /// Send buffered symbols and flush Outer
+        static void flush() {
+            if (size_ > 0) {
+                internal::send_block<Outer>(buffer_, size_);
+                size_ = 0;
+            }
+
+            internal::flush<Outer>();
+        }
+    private:
+        static i8_t buffer_[Size];
+        static word_t size_;
+    };
+
+    template <typename Outer, word_t Size, typename Flush>
+    i8_t buffered_outer<Outer, Size, Flush>::buffer_[Size];
+
+    template <typename Outer, word_t Size, typename Flush>
+    word_t buffered_outer<Outer, Size, Flush>::size_ = 0;
+
+    namespace internal {
+        /// Formatting of lp::out arguments, shared by lp::out and
+        /// lp::format_buffer. Output puts symbol with put(symbol) and
+        /// block with put(data, size), it can replace put_string and
+        /// put_number
+        template <typename Output>
+        class formatter {
+        public:
+            constexpr void send(const i8_t symbol) {
+                output().put(symbol);
+            }
+
+            /// String with unknown length, scanned for '\0'
+            template <typename T, typename =
+                std::enable_if_t<std::is_same<T, i8_t>::value>>
+            constexpr void send(const T * const &string) {
+                output().put_string(string);
+            }
+
+            /// String in array, sent as one block up to the first '\0',
+            /// at most N - 1 symbols
+            template <word_t N>
+            constexpr void send(const i8_t (&string)[N]) {
+                output().put(string, string_size(string, N - 1));
+            }
+
+            template <word_t N>
+            constexpr void send(i8_t (&string)[N]) {
+                send(const_cast<const i8_t (&)[N]>(string));
+            }
+
+            template <i8_t ...Chars>
+            constexpr void send(literal<Chars...>) {
+                output().put(literal<Chars...>::data, sizeof...(Chars));
+            }
+
+            constexpr void send(const i16_t number,
+                const number_base out_base = number_base::dec) {
+                send(static_cast<i32_t>(number), out_base);
+            }
+
+            constexpr void send(const i32_t number,
+                const number_base out_base = number_base::dec) {
+                if (number < 0) {
+                    send('-');
+                    send(0 - static_cast<u32_t>(number), out_base);
+                } else {
+                    send(static_cast<u32_t>(number), out_base);
+                }
+            }
+
+            constexpr void send(const u8_t number,
+                const number_base out_base = number_base::dec) {
+                send(static_cast<u32_t>(number), out_base);
+            }
+
+            constexpr void send(const u16_t number,
+                const number_base out_base = number_base::dec) {
+                send(static_cast<u32_t>(number), out_base);
+            }
+
+            template <typename T>
+            constexpr void send(const to_base<T> t) {
+                send(t.t, t.bs);
+            }
+
+            constexpr void send(const u32_t number,
+                const number_base out_base = number_base::dec) {
+                output().put_number(number, out_base);
+            }
+
+            constexpr void send(const i64_t number,
+                const number_base out_base = number_base::dec) {
+                if (number < 0) {
+                    send('-');
+                    send(0 - static_cast<u64_t>(number), out_base);
+                } else {
+                    send(static_cast<u64_t>(number), out_base);
+                }
+            }
+
+            /// Numbers fitting u32_t are formatted as u32_t
+            constexpr void send(const u64_t number,
+                const number_base out_base = number_base::dec) {
+                if (number <= 0xffffffffull) {
+                    send(static_cast<u32_t>(number), out_base);
+                } else {
+                    output().put_number(number, out_base);
+                }
+            }
+
+            constexpr void send() {}
+
+            template <typename Out_1, typename Out_2, typename ...Outs>
+            constexpr void send(Out_1 &&out_1, Out_2 &&out_2,
+                Outs &&...outs) {
+                send(std::forward<Out_1>(out_1));
+                send(std::forward<Out_2>(out_2), std::forward<Outs>(outs)...);
+            }
+
+            /// Number followed by base is sent in that base
+            template <typename Number, typename Out, typename ...Outs>
+            constexpr void send(Number &&number, const number_base out_base,
+                Out &&out, Outs &&...outs) {
+                send(std::forward<Number>(number), out_base);
+                send(std::forward<Out>(out), std::forward<Outs>(outs)...);
+            }
+
+            /// Adjacent literals are sent as one merged literal
+            template <i8_t ...Chars_1, i8_t ...Chars_2, typename ...Outs>
+            constexpr void send(literal<Chars_1...>, literal<Chars_2...>,
+                Outs &&...outs) {
+                send(literal<Chars_1..., Chars_2...>{},
+                    std::forward<Outs>(outs)...);
+            }
+
+            /// Format string parsed at compile time: fields {} are
+            /// replaced by args, {x}, {o}, {b} select base, text between
+            /// fields is sent as literal blocks
+            template <i8_t ...Chars, typename ...Args>
+            constexpr void format(literal<Chars...> string,
+                Args &&...args) {
+                internal::format(*this, string, std::forward<Args>(args)...);
+            }
+        protected:
+            constexpr void put_string(const i8_t *string) {
+                output().put(string, string_size(string, ~word_t(0)));
+            }
+
+            /// Number is formatted to stack and put as one block
+            template <typename T>
+            constexpr void put_number(const T number,
+                const number_base out_base) {
+                i8_t output_buff[sizeof(T) * 8 + 1] = {}; // bits + '\0'
+
+                i8_t *end = output_buff + sizeof(T) * 8;
+                const i8_t *pout = format_number(end, number, out_base);
+
+                output().put(pout, end - pout);
+            }
+        private:
+            constexpr Output & output() {
+                return static_cast<Output &>(*this);
+            }
+        };
+
+        /// Formatter output to static Outer
+        template <typename Outer>
+        class outer_output : public formatter<outer_output<Outer>> {
+            friend class formatter<outer_output>;
+
+            constexpr void put(const i8_t symbol) {
+                Outer::send(symbol);
+            }
+
+            constexpr void put(const i8_t *data, const word_t size) {
+                send_block<Outer>(data, size);
+            }
+
+            /// Outer without block send takes symbols in one pass
+            constexpr void put_string(const i8_t *string) {
+                put_string(string, has_block_send<Outer>{});
+            }
+
+            constexpr void put_string(const i8_t *string, std::true_type) {
+                Outer::send(string, string_size(string, ~word_t(0)));
+            }
+
+            constexpr void put_string(const i8_t *string, std::false_type) {
+                while (*string != '\0') {
+                    Outer::send(*string++);
+                }
+            }
+        };
+    } // namespace internal
+
     template <typename Outer, typename Type = u32_t>
     class out {
     public:
         using outer = Outer;
         static constexpr auto t_bit_size = sizeof(Type) * 8;
 
-        enum struct base : u8_t {
-            bin = 2,
-            oct = 8,
-            dec = 10,
-            hex = 16,
-            alpha = 36
-        };
+        using base = number_base;
 
         template <typename T>
-        struct to_base {
-            const base bs;
-            const T t;
-        };
+        using to_base = lp::to_base<T>;
 
         template <typename T>
         static constexpr to_base<T> make_base(const base bs, const T t) {
-            return to_base<T>{bs, t};
+            return lp::make_base(bs, t);
+        }
+
+        /// Symbols, strings, literals and numbers, a number followed by
+        /// base is sent in that base
+        template <typename ...Args>
+        static constexpr void send(Args &&...args) {
+            internal::outer_output<outer> output{};
+            output.send(std::forward<Args>(args)...);
+        }
+
+        /// Format string parsed at compile time: fields {} are replaced
+        /// by args, {x}, {o}, {b} select base, text between fields is sent
+        /// as literal blocks
+        template <i8_t ...Chars, typename ...Args>
+        static constexpr void format(literal<Chars...> string,
+            Args &&...args) {
+            internal::outer_output<outer> output{};
+            output.format(string, std::forward<Args>(args)...);
         }
 
-        static constexpr void send(const i8_t symbol) {
-            outer::send(symbol);
+        /// Send buffered output of outer
+        static constexpr void flush() {
+            internal::flush<outer>();
         }
+    };
+
+    /// Importance of fan_out output
+    enum struct out_level : u8_t {
+        debug,
+        info,
+        warning,
+        error
+    };
+
+    /// Sink of fan_out - Outer takes output of Level and higher
+    template <typename Outer, out_level Level = out_level::debug>
+    struct out_sink {
+        using outer = Outer;
+        static constexpr out_level level = Level;
+    };
+
+    namespace internal {
+        /// Plain Outer in sink list takes every level
+        template <typename Outer>
+        struct out_sink_of {
+            using type = out_sink<Outer>;
+        };
+
+        template <typename Outer, out_level Level>
+        struct out_sink_of<out_sink<Outer, Level>> {
+            using type = out_sink<Outer, Level>;
+        };
 
-        static constexpr void send(const i8_t *string) {
-            while (*string != '\0') {
-                outer::send(*string++);
+        /// Sink takes output of Level
+        template <out_level Level>
+        struct out_sink_takes {
+            template <typename Sink>
+            using test = std::integral_constant<bool, Sink::level <= Level>;
+        };
+
+        /// Outer sending every symbol and block to all Sinks
+        template <typename ...Sinks>
+        struct fan_out_outer {
+            static void send(const i8_t symbol) {
+                const bool expand[] = {false,
+                    (Sinks::outer::send(symbol), false)...};
+                static_cast<void>(expand);
             }
+
+            static void send(const i8_t *data, const word_t size) {
+                const bool expand[] = {false,
+                    (send_block<typename Sinks::outer>(data, size), false)...};
+                static_cast<void>(expand);
+            }
+        };
+    } // namespace internal
+
+    /// Output to several Outers - values are formatted once to staging
+    /// buffer of Size symbols, which is sent as block to every sink of
+    /// level, sinks are selected at compile time and message without
+    /// sinks is dropped with its formatting, one staging buffer is kept
+    /// per used sink selection
+    template <typename Outers, word_t Size = 64, typename Type = u32_t>
+    class fan_out;
+
+    template <typename ...Outers, word_t Size, typename Type>
+    class fan_out<type_list<Outers...>, Size, Type> {
+        static_assert(Size >= sizeof(u64_t) * 8,
+            "staging buffer takes binary u64_t");
+
+        using all_sinks =
+            type_list<typename internal::out_sink_of<Outers>::type...>;
+    public:
+        /// Sinks taking output of Level
+        template <out_level Level>
+        using sinks = typename all_sinks::template filter<
+            internal::out_sink_takes<Level>::template test>;
+
+        /// Send to sinks of Level
+        template <out_level Level, typename ...Args>
+        static void send(Args &&...args) {
+            send_at<Level>(has_sinks<Level>{}, std::forward<Args>(args)...);
         }
 
-        static constexpr void send(const i16_t number,
-            const base out_base = base::dec) {
-            send(static_cast<i32_t>(number), out_base);
+        /// Send to every sink
+        template <typename ...Args>
+        static void send(Args &&...args) {
+            send<out_level::error>(std::forward<Args>(args)...);
         }
 
-        static constexpr void send(const i32_t number,
-            const base out_base = base::dec) {
-            if (number < 0) {
-                send('-');
-                send(static_cast<u32_t>(number * -1), out_base);
+        /// Compile time parsed format string as by lp::out::format
+        template <out_level Level, i8_t ...Chars, typename ...Args>
+        static void format(literal<Chars...> string, Args &&...args) {
+            format_at<Level>(has_sinks<Level>{}, string,
+                std::forward<Args>(args)...);
+        }
+
+        template <i8_t ...Chars, typename ...Args>
+        static void format(literal<Chars...> string, Args &&...args) {
+            format<out_level::error>(string, std::forward<Args>(args)...);
+        }
+
+        /// Flush outers of all sinks
+        static void flush() {
+            const bool expand[] = {false,
+                (internal::flush<typename internal::out_sink_of<
+                    Outers>::type::outer>(), false)...};
+            static_cast<void>(expand);
+        }
+    private:
+        template <out_level Level>
+        using has_sinks = std::integral_constant<bool,
+            (sinks<Level>::size > 0)>;
+
+        template <out_level Level>
+        using stage = buffered_outer<typename sinks<Level>::template assign<
+            internal::fan_out_outer>, Size, flush_on_full>;
+
+        template <out_level Level>
+        using stage_out = out<stage<Level>, Type>;
+
+        template <out_level Level, typename ...Args>
+        static void send_at(std::true_type, Args &&...args) {
+            stage_out<Level>::send(std::forward<Args>(args)...);
+            stage<Level>::flush();
+        }
+
+        template <out_level Level, typename ...Args>
+        static void send_at(std::false_type, Args &&...) {}
+
+        template <out_level Level, i8_t ...Chars, typename ...Args>
+        static void format_at(std::true_type, literal<Chars...> string,
+            Args &&...args) {
+            stage_out<Level>::format(string, std::forward<Args>(args)...);
+            stage<Level>::flush();
+        }
+
+        template <out_level Level, i8_t ...Chars, typename ...Args>
+        static void format_at(std::false_type, literal<Chars...>,
+            Args &&...) {}
+    };
+
+    /// Output to memory of caller - numbers and strings are formatted as
+    /// by lp::out, symbols over capacity are dropped, no '\0' is put
+    class format_buffer : public internal::formatter<format_buffer> {
+        friend class internal::formatter<format_buffer>;
+    public:
+        constexpr format_buffer(i8_t *data, const word_t capacity)
+            : data_{data}, capacity_{capacity}, size_{0},
+            truncated_{false} {}
+
+        /// Block of symbols, cut to free space, size of literal stays
+        /// constant for copy when block fits
+        constexpr void append(const i8_t *data, const word_t size) {
+            const word_t free = capacity_ - size_;
+
+            if (size <= free) {
+                copy(data, size);
             } else {
-                send(static_cast<u32_t>(number), out_base);
+                copy(data, free);
+                truncated_ = true;
             }
         }
 
-        static constexpr void send(const u8_t number,
-            const base out_base = base::dec) {
-            send(static_cast<u32_t>(number), out_base);
+        constexpr const i8_t * data() const {
+            return data_;
         }
 
-        static constexpr void send(const u16_t number,
-            const base out_base = base::dec) {
-            send(static_cast<u32_t>(number), out_base);
+        /// Number of written symbols
+        constexpr word_t size() const {
+            return size_;
         }
 
-        template <typename T>
-        static constexpr void send(const to_base<T> t) {
-            send(t.t, t.bs);
+        constexpr word_t capacity() const {
+            return capacity_;
         }
 
-        static constexpr void send(const u32_t number,
-            const base out_base = base::dec) {
-            i8_t output_buff[t_bit_size + 1]; // number of bits + '\0'
+        /// Some symbols were dropped for lack of space
+        constexpr bool truncated() const {
+            return truncated_;
+        }
 
-            const i8_t *pout =
-                convert(output_buff + t_bit_size, number, out_base);
+        constexpr void clear() {
+            size_ = 0;
+            truncated_ = false;
+        }
+    private:
+        using formatter = internal::formatter<format_buffer>;
+
+        constexpr void put(const i8_t symbol) {
+            if (size_ < capacity_) {
+                data_[size_++] = symbol;
+            } else {
+                truncated_ = true;
+            }
+        }
 
-            send(pout);
+        constexpr void put(const i8_t *data, const word_t size) {
+            append(data, size);
         }
 
-        template <typename Out, typename ...Outs>
-        static constexpr void send(Out out, Outs ...outs) {
-            send(out);
-            send(outs...);
+        /// Decimal digits are put right to their place when they fit
+        constexpr void put_number(const u32_t number,
+            const number_base out_base) {
+            if (out_base == number_base::dec && capacity_ - size_ >= 10) {
+                size_ += internal::dec_count(number);
+                internal::number_format::dec_digits(data_ + size_, number);
+            } else {
+                formatter::put_number(number, out_base);
+            }
         }
-    private:
-        static constexpr i8_t * convert(
-            i8_t *output_buff,
-            u32_t number,
-            const base out_base) {
-            *output_buff-- = '\0';
-            do {
-                i8_t dig = number % static_cast<u8_t>(out_base);
-                if (dig > 9)
-                    dig += 0x27;
-                *output_buff-- = dig + '0';
-                number /=
-                    static_cast<u8_t>(out_base);
-            } while (number > 0);
-
-            return output_buff + 1;
+
+        constexpr void put_number(const u64_t number,
+            const number_base out_base) {
+            formatter::put_number(number, out_base);
+        }
+
+        constexpr void copy(const i8_t *data, const word_t size) {
+            i8_t *out = data_ + size_;
+            for (word_t i = 0; i < size; i++) {
+                out[i] = data[i];
+            }
+
+            size_ += size;
         }
+
+        i8_t *data_;
+        word_t capacity_;
+        word_t size_;
+        bool truncated_;
+    };
+
+    /// Result of lp::format_to
+    struct format_result {
+        word_t size; ///< number of written symbols
+        bool truncated; ///< some symbols were dropped for lack of space
     };
+
+    /// Format args to buffer of capacity symbols as lp::out sends them,
+    /// no '\0' is put
+    template <typename ...Args>
+    constexpr format_result format_to(i8_t *buffer, const word_t capacity,
+        Args &&...args) {
+        format_buffer output{buffer, capacity};
+        output.send(std::forward<Args>(args)...);
+
+        return {output.size(), output.truncated()};
+    }
 }
 
 #endif // LP_CC_LIB_OUT_HH
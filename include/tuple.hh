@@ -31,12 +31,14 @@ namespace std {
     class tuple;
 
     namespace internal {
-        /// Head base implementation
-        template <size_t Index, typename Head, bool Is_empty_not_final>
+        /// Head base implementation, special members are defaulted so
+        /// tuple of trivially copyable types is trivially copyable
+        template <size_t Index, typename Head, bool Is_empty_not_final,
+            bool Is_reference = is_reference<Head>::value>
         struct head_base;
 
         template <size_t Index, typename Head>
-        struct head_base<Index, Head, true>
+        struct head_base<Index, Head, true, false>
             : Head {
             constexpr head_base() noexcept
                 : Head{} {}
@@ -50,7 +52,11 @@ namespace std {
 
             template <typename T_head>
             constexpr head_base(T_head &&head) noexcept
-                : Head{forward<T_head>(head)} {}
+                : Head(forward<T_head>(head)) {}
+
+            constexpr head_base & operator = (const head_base &) = default;
+
+            constexpr head_base & operator = (head_base &&) = default;
 
             static constexpr Head & get_head(head_base &base) noexcept {
                 return base;
@@ -63,7 +69,7 @@ namespace std {
         };
 
         template <size_t Index, typename Head>
-        struct head_base<Index, Head, false> {
+        struct head_base<Index, Head, false, false> {
             constexpr head_base() noexcept
                 : head_{} {}
 
@@ -76,7 +82,46 @@ namespace std {
 
             template <typename T_head>
             constexpr head_base(T_head &&head) noexcept
-                : head_{forward<T_head>(head)} {}
+                : head_(forward<T_head>(head)) {}
+
+            constexpr head_base & operator = (const head_base &) = default;
+
+            constexpr head_base & operator = (head_base &&) = default;
+
+            static constexpr Head & get_head(head_base &base) noexcept {
+                return base.head_;
+            }
+
+            static constexpr const Head &
+            get_head(const head_base &base) noexcept {
+                return base.head_;
+            }
+
+            Head head_;
+        };
+
+        /// Reference head, assignment writes to referenced object
+        template <size_t Index, typename Head>
+        struct head_base<Index, Head, false, true> {
+            constexpr head_base(const head_base &) noexcept = default;
+
+            constexpr head_base(head_base &&) noexcept = default;
+
+            template <typename T_head>
+            constexpr head_base(T_head &&head) noexcept
+                : head_(forward<T_head>(head)) {}
+
+            constexpr head_base & operator = (const head_base &base) {
+                head_ = base.head_;
+
+                return *this;
+            }
+
+            constexpr head_base & operator = (head_base &&base) {
+                head_ = forward<Head>(base.head_);
+
+                return *this;
+            }
 
             static constexpr Head & get_head(head_base &base) noexcept {
                 return base.head_;
@@ -108,210 +153,167 @@ namespace std {
                 is_empty_non_tuple<T>
             >;
 
-        /// Tuple implementation
-        template <size_t Index, typename ...Types>
+        /// Tuple implementation - flat layout, every element is direct base
+        template <typename Indexes, typename ...Types>
         struct tuple_impl;
 
-        template <size_t Index, typename Head, typename ...Tail>
-        struct tuple_impl<Index, Head, Tail...>
-            : tuple_impl<Index + 1, Tail...>,
-            head_base<Index, Head, is_empty_not_final<Head>::value> {
+        template <size_t ...Index, typename ...Types>
+        struct tuple_impl<index_sequence<Index...>, Types...>
+            : head_base<Index, Types, is_empty_not_final<Types>::value>... {
 
-            using inherit = tuple_impl<Index + 1, Tail...>;
-            using base =
-                head_base<Index, Head, is_empty_not_final<Head>::value>;
-
-            static constexpr Head & get_head(tuple_impl & tuple) noexcept {
-                return base::get_head(tuple); }
-
-            static constexpr const Head &
-            get_head(const tuple_impl &tuple) noexcept {
-                return base::get_head(tuple);
-            }
-
-            static constexpr inherit & get_tail(tuple_impl &tuple) noexcept {
-                return tuple;
-            }
-
-            static constexpr const inherit &
-            get_tail(const tuple_impl &tuple) noexcept {
-                return tuple;
-            }
+            template <size_t I, typename Head>
+            using base = head_base<I, Head, is_empty_not_final<Head>::value>;
 
             constexpr tuple_impl() noexcept
-                : inherit{}, base{} {}
+                : base<Index, Types>{}... {}
 
-            explicit constexpr
-            tuple_impl(const Head &head, const Tail &...tail) noexcept
-                : inherit{tail...}, base{head} {}
+            explicit constexpr tuple_impl(const Types &...elements) noexcept
+                : base<Index, Types>{elements}... {}
 
-            template <typename U_head, typename ...U_tail,
-                typename =
-                    enable_if_t<sizeof...(Tail) == sizeof...(U_tail)>> 
-            explicit constexpr
-            tuple_impl(U_head &&head, U_tail &&...tail) noexcept
-                : inherit(forward<U_tail>(tail)...),
-                base(forward<U_head>(head)) { }
+            template <typename ...UTypes, typename =
+                enable_if_t<sizeof...(Types) == sizeof...(UTypes)>>
+            explicit constexpr tuple_impl(UTypes &&...elements) noexcept
+                : base<Index, Types>(forward<UTypes>(elements))... {}
 
             constexpr tuple_impl(const tuple_impl &) noexcept = default;
 
-            constexpr tuple_impl(tuple_impl && tuple)
-                noexcept(and_pred<is_nothrow_move_constructible<Head>,
-                    is_nothrow_move_constructible<inherit>>::value)
-                : inherit(move(get_tail(tuple))), 
-                base(forward<Head>(get_head(tuple))) {}
-
-            template <typename ...U_elements>
-            constexpr
-            tuple_impl(const tuple_impl<Index, U_elements...> &tuple) noexcept
-                : inherit(tuple_impl<Index, U_elements...>::get_tail(tuple)),
-                base(tuple_impl<Index, U_elements...>::get_head(tuple)) {}
-
-            template <typename U_head, typename ...U_tail>
-            constexpr
-            tuple_impl(tuple_impl<Index, U_head, U_tail...> &&tuple) noexcept
-                : inherit(move(tuple_impl<Index, U_head, U_tail...>::
-                    get_tail(tuple))),
-                base(forward<U_head>(tuple_impl<Index, U_head, U_tail...>::
-                    get_head(tuple))) {}
+            constexpr tuple_impl(tuple_impl &&) = default;
 
-            constexpr tuple_impl & operator =
-            (const tuple_impl & tuple) noexcept {
-                get_head(*this) = get_head(tuple);
-                get_tail(*this) = get_tail(tuple);
+            template <typename ...UTypes>
+            constexpr tuple_impl(
+                const tuple_impl<index_sequence<Index...>, UTypes...> &tuple)
+                noexcept
+                : base<Index, Types>(
+                    base<Index, UTypes>::get_head(tuple))... {}
 
-                return *this;
-            }
+            template <typename ...UTypes>
+            constexpr tuple_impl(
+                tuple_impl<index_sequence<Index...>, UTypes...> &&tuple)
+                noexcept
+                : base<Index, Types>(forward<UTypes>(
+                    base<Index, UTypes>::get_head(tuple)))... {}
+
+            constexpr tuple_impl & operator = (const tuple_impl &) = default;
 
-            template <typename ...U_elements>
+            constexpr tuple_impl & operator = (tuple_impl &&) = default;
+
+            template <typename ...UTypes>
             constexpr tuple_impl & operator =
-            (const tuple_impl<Index, U_elements...> &tuple) noexcept {
-                get_head(*this) =
-                    tuple_impl<Index, U_elements...>::get_head(tuple);
-                get_tail(*this) =
-                    tuple_impl<Index, U_elements...>::get_tail(tuple);
+            (const tuple_impl<index_sequence<Index...>, UTypes...> &tuple)
+                noexcept {
+                const bool expand[] = {false,
+                    (base<Index, Types>::get_head(*this) =
+                        base<Index, UTypes>::get_head(tuple), false)...};
+                static_cast<void>(expand);
 
                 return *this;
             }
 
-            template <typename U_head, typename ...U_tail>
+            template <typename ...UTypes>
             constexpr tuple_impl & operator =
-            (tuple_impl<Index, U_head, U_tail...> && tuple) noexcept {
-                get_head(*this) =
-                    forward<U_head>(
-                        tuple_impl<Index, U_head, U_tail...>::get_head(tuple));
-                get_tail(*this) =
-                    move
-                        (tuple_impl<Index, U_head, U_tail...>::get_tail(tuple));
+            (tuple_impl<index_sequence<Index...>, UTypes...> &&tuple)
+                noexcept {
+                const bool expand[] = {false,
+                    (base<Index, Types>::get_head(*this) = forward<UTypes>(
+                        base<Index, UTypes>::get_head(tuple)), false)...};
+                static_cast<void>(expand);
 
                 return *this;
             }
 
             constexpr void apply_swap(tuple_impl &tuple)
-                noexcept(
-                    noexcept(swap(declval<Head &>(), declval<Head &>()))
-                    && noexcept(get_tail(tuple).apply_swap(get_tail(tuple)))) {
-                swap(get_head(*this), get_head(tuple));
-                inherit::apply_swap(get_tail(tuple));
+                noexcept(and_pred<integral_constant<bool,
+                    noexcept(swap(declval<Types &>(),
+                        declval<Types &>()))>...>::value) {
+                const bool expand[] = {false,
+                    (swap(base<Index, Types>::get_head(*this),
+                        base<Index, Types>::get_head(tuple)), false)...};
+                static_cast<void>(expand);
             }
         };
 
-        template <size_t Index, typename Head>
-        struct tuple_impl<Index, Head>
-            : head_base<Index, Head, is_empty_not_final<Head>::value> {
-            using base =
-                head_base<Index, Head, is_empty_not_final<Head>::value>;
-
-            static constexpr Head & get_head(tuple_impl &tuple) noexcept {
-                return base::get_head(tuple);
+        template <typename ...Types>
+        using tuple_impl_for =
+            tuple_impl<index_sequence_for<Types...>, Types...>;
+
+        /// Constructor tag of tuple storage
+        struct tuple_storage_tag {};
+
+        /// Tuple storage - elements are member of tuple, GCC assembles
+        /// returned bases of bases with data through stack, empty
+        /// implementation is base and keeps tuple of empty types empty
+        template <typename Impl, bool = is_empty<Impl>::value>
+        struct tuple_storage {
+            template <typename ...Args>
+            explicit constexpr tuple_storage(tuple_storage_tag,
+                Args &&...args) noexcept
+                : impl_(forward<Args>(args)...) {}
+
+            constexpr Impl & impl() noexcept {
+                return impl_;
             }
 
-            static constexpr const Head &
-            get_head(const tuple_impl &tuple) noexcept {
-                return base::get_head(tuple);
+            constexpr const Impl & impl() const noexcept {
+                return impl_;
             }
 
-            constexpr tuple_impl() noexcept
-                : base{} {}
-
-            explicit constexpr tuple_impl(const Head &head) noexcept
-                : base{head} {}
-
-            template <typename U_head>
-            explicit constexpr tuple_impl(U_head &&head)
-                : base(forward<U_head>(head)) {}
-
-            constexpr tuple_impl(const tuple_impl &) noexcept = default;
-
-            constexpr tuple_impl(tuple_impl &&tuple)
-                noexcept(is_nothrow_move_constructible<Head>::value)
-                : base(forward<Head>(get_head(tuple))) {}
-
-            template <typename U_head>
-            constexpr
-            tuple_impl(const tuple_impl<Index, U_head> &tuple) noexcept
-                : base(tuple_impl<Index, U_head>::get_head(tuple)) {}
-
-            template <typename U_head>
-            constexpr tuple_impl(tuple_impl<Index, U_head> &&tuple) noexcept
-                : base(forward<U_head>(tuple_impl<Index, U_head>::
-                    get_head(tuple))) {}
-	
-            constexpr tuple_impl & operator = (const tuple_impl &tuple) noexcept {
-                get_head(*this) = get_head(tuple);
-
-                return *this;
-            }
+            Impl impl_;
+        };
 
-            constexpr tuple_impl & operator = (tuple_impl &&tuple)
-                noexcept(is_nothrow_move_assignable<Head>::value) {
-                get_head(*this) = forward<Head>(get_head(tuple));
+        template <typename Impl>
+        struct tuple_storage<Impl, true> : Impl {
+            template <typename ...Args>
+            explicit constexpr tuple_storage(tuple_storage_tag,
+                Args &&...args) noexcept
+                : Impl(forward<Args>(args)...) {}
 
+            constexpr Impl & impl() noexcept {
                 return *this;
             }
 
-            template <typename U_head>
-            constexpr tuple_impl & operator =
-            (const tuple_impl<Index, U_head> &tuple) noexcept {
-                get_head(*this) = tuple_impl<Index, U_head>::get_head(tuple);
-
+            constexpr const Impl & impl() const noexcept {
                 return *this;
             }
+        };
 
-            template <typename U_head>
-            constexpr tuple_impl & operator =
-            (tuple_impl<Index, U_head> &&tuple) noexcept {
-                get_head(*this) =
-                    forward<U_head>(tuple_impl<Index, U_head>::get_head(tuple));
-
-                return *this;
+        /// Access to storage of tuple
+        struct tuple_access {
+            template <typename ...Types>
+            static constexpr tuple_impl_for<Types...> &
+            impl(tuple<Types...> &tuple) noexcept {
+                return tuple.impl();
             }
 
-            constexpr void apply_swap(tuple_impl& tuple)
-                noexcept(
-                    noexcept(
-                        swap(std::declval<Head&>(), std::declval<Head&>()))) {
-                swap(get_head(*this), get_head(tuple));
+            template <typename ...Types>
+            static constexpr const tuple_impl_for<Types...> &
+            impl(const tuple<Types...> &tuple) noexcept {
+                return tuple.impl();
             }
         };
     } // namespace internal
 
     /// Tuple
     template <typename ...Types>
-    class tuple : public internal::tuple_impl<0, Types...> {
-        using inherit = internal::tuple_impl<0, Types...>;
+    class tuple
+        : private internal::tuple_storage<internal::tuple_impl_for<Types...>> {
+        using inherit = internal::tuple_impl_for<Types...>;
+        using storage = internal::tuple_storage<inherit>;
+        using tag = internal::tuple_storage_tag;
+        using access = internal::tuple_access;
+
+        friend access;
     public:
         constexpr tuple() noexcept
-            : inherit{} {}
+            : storage{tag{}} {}
 
         explicit constexpr tuple(const Types &...elements) noexcept
-            : inherit{elements...} {}
+            : storage{tag{}, elements...} {}
 
         template <typename ...UTypes, typename =
             typename enable_if<
                 and_pred<is_convertible<UTypes, Types>...>::value>::type>
         explicit constexpr tuple(UTypes &&...elements) noexcept
-            : inherit{forward<UTypes>(elements)...} {}
+            : storage{tag{}, forward<UTypes>(elements)...} {}
 
         constexpr tuple(const tuple &) noexcept = default;
 
@@ -322,35 +324,23 @@ namespace std {
                 and_pred<is_convertible<const UTypes &, Types>...>::value
                     >::type>
         constexpr tuple(const tuple<UTypes...>& tuple) noexcept
-            : inherit
-                {static_cast<
-                    const internal::tuple_impl<0, UTypes ...> &>(tuple)} {}
+            : storage{tag{}, access::impl(tuple)} {}
 
         template <typename ...UTypes, typename =
             typename enable_if<
                 and_pred<is_convertible<UTypes,
                     Types>...>::value>::type>
         constexpr tuple(tuple<UTypes...> &&tuple) noexcept
-            : inherit
-                {static_cast<internal::tuple_impl<0, UTypes ...>&&>(tuple)} {}
-
-        constexpr tuple & operator = (const tuple &tuple) noexcept {
-            static_cast<inherit &>(*this) = tuple;
+            : storage{tag{}, move(access::impl(tuple))} {}
 
-            return *this;
-        }
+        constexpr tuple & operator = (const tuple &) = default;
 
-        constexpr tuple & operator = (tuple &&tuple)
-            noexcept(is_nothrow_move_assignable<inherit>::value) {
-            static_cast<inherit &>(*this) = move(tuple);
-
-            return *this;
-        }
+        constexpr tuple & operator = (tuple &&) = default;
 
         template <typename ...UTypes, typename =
             typename enable_if<sizeof...(UTypes) == sizeof...(Types)>::type>
         constexpr tuple & operator = (const tuple<UTypes ...> &tuple) noexcept {
-            static_cast<inherit &>(*this) = tuple;
+            storage::impl() = access::impl(tuple);
 
             return *this;
         }
@@ -358,14 +348,15 @@ namespace std {
         template <typename ...UTypes, typename = typename
             enable_if<sizeof...(UTypes) == sizeof...(Types)>::type>
         constexpr tuple & operator = (tuple<UTypes ...> &&tuple) {
-            static_cast<inherit &>(*this) = move(tuple);
+            storage::impl() = move(access::impl(tuple));
 
             return *this;
         }
 
         constexpr void swap(tuple &tuple)
-            noexcept(noexcept(tuple.apply_swap(tuple))) {
-            inherit::apply_swap(tuple);
+            noexcept(noexcept(declval<inherit &>().apply_swap(
+                declval<inherit &>()))) {
+            storage::impl().apply_swap(tuple.impl());
         }
     };
 
@@ -380,13 +371,24 @@ namespace std {
     template <size_t Index, typename T>
     struct tuple_element;
 
-    template <size_t Index, typename Head, typename ...Tail>
-    struct tuple_element<Index, tuple<Head, Tail...>>
-        : tuple_element<Index - 1, tuple<Tail ...>> {};
+    namespace internal {
+        template <typename T>
+        struct element_type {
+            using type = T;
+        };
+
+        /// Element type selected by base deduction, without recursion
+        template <size_t Index, typename Head, bool Is_empty_not_final>
+        element_type<Head>
+        get_element_type(const head_base<Index, Head, Is_empty_not_final> &);
+    } // namespace internal
+
+    template <size_t Index, typename ...Types>
+    struct tuple_element<Index, tuple<Types...>> {
+        static_assert(Index < sizeof...(Types), "tuple index is in range");
 
-    template <typename Head, typename ...Tail>
-    struct tuple_element<0, tuple<Head, Tail ...>> {
-        using type = Head;
+        using type = typename decltype(internal::get_element_type<Index>(
+            declval<const internal::tuple_impl_for<Types...> &>()))::type;
     };
 
     template <size_t Index, typename T>
@@ -428,16 +430,16 @@ namespace std {
         : integral_constant<size_t, sizeof...(Types)> {};
 
     namespace internal {
-        template <size_t i, typename Head, typename ...Tail>
+        template <size_t i, typename Head, bool Is_empty_not_final>
         constexpr Head &
-        get_h(tuple_impl<i, Head, Tail ...>& tuple) noexcept {
-            return tuple_impl<i, Head, Tail ...>::get_head(tuple);
+        get_h(head_base<i, Head, Is_empty_not_final> &base) noexcept {
+            return head_base<i, Head, Is_empty_not_final>::get_head(base);
         }
 
-        template <size_t i, typename Head, typename ...Tail>
+        template <size_t i, typename Head, bool Is_empty_not_final>
         constexpr const Head &
-        get_h(const tuple_impl<i, Head, Tail ...> &tuple) noexcept {
-            return tuple_impl<i, Head, Tail ...>::get_head(tuple);
+        get_h(const head_base<i, Head, Is_empty_not_final> &base) noexcept {
+            return head_base<i, Head, Is_empty_not_final>::get_head(base);
         }
     } // namespace internal
 
@@ -445,13 +447,13 @@ namespace std {
     template <size_t i, typename ...Types>
     constexpr tuple_element_t<i, tuple<Types...>> &
     get(tuple<Types...> &tuple) noexcept {
-        return internal::get_h<i>(tuple);
+        return internal::get_h<i>(internal::tuple_access::impl(tuple));
     }
 
     template <size_t i, typename ...Types>
     constexpr const tuple_element_t<i, tuple<Types...>> &
     get(const tuple<Types...> &tuple) noexcept {
-        return internal::get_h<i>(tuple);
+        return internal::get_h<i>(internal::tuple_access::impl(tuple));
     }
 
     template <size_t i, typename ...Types>
@@ -462,32 +464,74 @@ namespace std {
     }
 
     namespace internal {
-        template <typename Head, size_t i, typename... Tail>
+        /// Number of occurrences, used only to explain failed lookup
+        template <typename T, typename Impl>
+        struct type_count;
+
+        template <typename T, size_t ...Index, typename ...Types>
+        struct type_count<T, tuple_impl<index_sequence<Index...>, Types...>> {
+            static constexpr size_t count() noexcept {
+                const bool same[] = {false, is_same<T, Types>::value...};
+                size_t result = 0;
+
+                for (auto s : same) {
+                    result += s;
+                }
+
+                return result;
+            }
+
+            static constexpr size_t value = count();
+        };
+
+        /// Converted from any tuple, so worse than the element base,
+        /// and explains failure only if converting is really used
+        template <typename T>
+        struct type_lookup_failed {
+            template <typename Impl>
+            constexpr type_lookup_failed(const Impl &) noexcept {
+                static_assert(type_count<T, Impl>::value != 0,
+                    "get<T>: T is not an element type of the tuple");
+                static_assert(type_count<T, Impl>::value < 2,
+                    "get<T>: T occurs more than once in the tuple");
+            }
+
+            static T & get_head() noexcept;
+        };
+
+        template <typename Head, size_t i, bool Is_empty_not_final>
         constexpr Head &
-        get_h_2(tuple_impl<i, Head, Tail ...>& tuple_) noexcept {
-            return tuple_impl<i, Head, Tail ...>::get_head(tuple_);
+        get_h_2(head_base<i, Head, Is_empty_not_final> &base) noexcept {
+            return head_base<i, Head, Is_empty_not_final>::get_head(base);
         }
 
-        template <typename Head, size_t i, typename... Tail>
+        template <typename Head, size_t i, bool Is_empty_not_final>
         constexpr const Head &
-        get_h_2(const tuple_impl<i, Head, Tail ...>& tuple_) noexcept {
-            return tuple_impl<i, Head, Tail ...>::get_head(tuple_);
+        get_h_2(const head_base<i, Head, Is_empty_not_final> &base) noexcept {
+            return head_base<i, Head, Is_empty_not_final>::get_head(base);
+        }
+
+        template <typename Head>
+        constexpr Head & get_h_2(type_lookup_failed<Head>) noexcept {
+            return type_lookup_failed<Head>::get_head();
         }
     } // namespace internal
 
+    /// Getting a tuple element by type, T must occur exactly once
     template <typename T, typename ...Types>
     constexpr T & get(tuple<Types ...> & tuple_) noexcept {
-        return internal::get_h_2<T>(tuple_);
+        return internal::get_h_2<T>(internal::tuple_access::impl(tuple_));
     }
 
     template <typename T, typename ...Types>
     constexpr T && get(tuple<Types ...>&& tuple_) noexcept {
-        return forward<T&&>(internal::get_h_2<T>(tuple_));
+        return forward<T&&>(
+            internal::get_h_2<T>(internal::tuple_access::impl(tuple_)));
     }
 
     template <typename T, typename ...Types>
     constexpr const T & get(const tuple<Types ...>& tuple_) noexcept {
-        return internal::get_h_2<T>(tuple_);
+        return internal::get_h_2<T>(internal::tuple_access::impl(tuple_));
     }
 
     /// Compare operators for tuple
@@ -516,6 +560,42 @@ namespace std {
                 return false;
             }
         };
+
+        /// Equality of tuples with same integral element types - xor of
+        /// every element pair is merged by or and tested once, without
+        /// branch per element
+        template <typename Tuple, typename Indexes>
+        struct tuple_integral_equal;
+
+        template <typename Tuple, size_t ...Index>
+        struct tuple_integral_equal<Tuple, index_sequence<Index...>> {
+            static constexpr bool eq(const Tuple &t, const Tuple &u)
+                noexcept {
+                unsigned long long diff = 0;
+                const bool expand[] = {false, (diff |= static_cast<
+                    unsigned long long>(get<Index>(t) ^ get<Index>(u)),
+                    false)...};
+                static_cast<void>(expand);
+
+                return diff == 0;
+            }
+        };
+
+        /// Equality implementation for pair of tuple types
+        template <typename T, typename U>
+        struct tuple_equal_for {
+            using type = tuple_compare<T, U, 0, tuple_size<T>::value>;
+        };
+
+        template <typename ...Types>
+        struct tuple_equal_for<tuple<Types...>, tuple<Types...>> {
+            using type = conditional_t<
+                and_pred<is_integral<Types>...>::value,
+                tuple_integral_equal<tuple<Types...>,
+                    index_sequence_for<Types...>>,
+                tuple_compare<tuple<Types...>, tuple<Types...>, 0,
+                    sizeof...(Types)>>;
+        };
     } // namespace internal
 
     template <typename ...T_types, typename ...U_types>
@@ -523,8 +603,8 @@ namespace std {
     (const tuple<T_types ...>& t, const tuple<U_types ...>& u) noexcept {
         static_assert(sizeof...(T_types) == sizeof...(U_types),
             "tuple objects can only be compared if they have equal sizes.");
-        using compare = internal::tuple_compare<
-            tuple<T_types ...>, tuple<U_types ...>, 0, sizeof...(T_types)>;
+        using compare = typename internal::tuple_equal_for<
+            tuple<T_types ...>, tuple<U_types ...>>::type;
         return compare::eq(t, u);
     }
 
@@ -612,83 +692,108 @@ namespace std {
                 typename combine_tuples<tuple<T1s..., T2s...>, Rem...>::type;
         };
 
-        template <size_t, typename, typename, size_t>
-        struct make_tuple_impl;
-
-        template <size_t Index, typename Tuple, typename ...Tp, size_t Nm>
-        struct make_tuple_impl<Index, tuple<Tp...>, Tuple, Nm>
-            : make_tuple_impl<
-                Index + 1,
-                tuple<Tp..., tuple_element_t<Index, Tuple>>, Tuple, Nm> {};
-
-        template <size_t Nm, typename Tuple, typename ...Tp>
-        struct make_tuple_impl<Nm, tuple<Tp...>, Tuple, Nm> {
-            using type = tuple<Tp...>;
-        };
-
-        template <typename Tuple>
-        struct do_make_tuple
-            : make_tuple_impl<0, tuple<>, Tuple, tuple_size<Tuple>::value> {};
-
-        template <typename Tuple>
-        struct make_tuple
-            : public do_make_tuple<typename remove_cv<
-                typename remove_reference<Tuple>::type>::type> {};
-
         template <typename ...Typles>
         struct tuple_cat_result {
-            using type = typename combine_tuples
-                <typename make_tuple<Typles>::type...>::type;
+            using type = typename combine_tuples<
+                remove_cv_t<remove_reference_t<Typles>>...>::type;
         };
 
-        template <typename...>
-        struct make_1st_indices;
+        /// Outer (tuple) and inner (element) indexes of all elements,
+        /// built by one loop over tuple sizes, which follow leading zero
+        template <size_t Total>
+        struct tuple_cat_table {
+            template <size_t N>
+            constexpr tuple_cat_table(const size_t (&sizes)[N]) noexcept
+                : outer{}, inner{} {
+                size_t at = 0;
+
+                for (size_t tuple = 1; tuple < N; tuple++) {
+                    for (size_t index = 0; index < sizes[tuple]; index++) {
+                        outer[at] = tuple - 1;
+                        inner[at] = index;
+                        at++;
+                    }
+                }
+            }
 
-        template <>
-        struct make_1st_indices<> {
-            using type = index_tuple<>;
+            size_t outer[Total + 1];
+            size_t inner[Total + 1];
         };
 
-        template <typename Tp, typename ...Tpls>
-        struct make_1st_indices<Tp, Tpls...> {
-            using type =
-                typename build_index_tuple<tuple_size<
-                    remove_reference_t<Tp>>::value>::type;
-        };
+        /// Forward element of tuple of references with its value category
+        template <size_t i, typename Head, bool Is_empty_not_final>
+        constexpr Head &&
+        get_forward(head_base<i, Head, Is_empty_not_final> &base) noexcept {
+            return forward<Head>(
+                head_base<i, Head, Is_empty_not_final>::get_head(base));
+        }
 
-        template <typename Ret, typename Indices, typename ...Typles>
+        /// Concatenation in one expansion over all elements
+        template <typename Ret, typename Indexes, typename ...Typles>
         struct tuple_concater;
 
-        template <typename Ret, size_t ...Is, typename Tp, typename ...Typles>
-        struct tuple_concater<Ret, index_tuple<Is...>, Tp, Typles...> {
-            template <typename ...Us>
-            static constexpr Ret
-            apply_do(Tp &&tp, Typles &&...tps, Us &&...us) noexcept {
-                using idx_t = typename make_1st_indices<Typles...>::type;
-                using next = tuple_concater<Ret, idx_t, Typles...>;
-                return next::apply_do(
-                    forward<Typles>(tps)...,
-                    forward<Us>(us)...,
-                    get<Is>(forward<Tp>(tp))...);
-            }
-        };
+        template <typename Ret, size_t ...Index, typename ...Typles>
+        struct tuple_concater<Ret, index_sequence<Index...>, Typles...> {
+            /// Leading zero keeps array of no tuples valid
+            static constexpr size_t sizes[] = {0,
+                tuple_size<remove_reference_t<Typles>>::value...};
+
+            static constexpr tuple_cat_table<sizeof...(Index)> table{sizes};
 
-        template <typename Ret>
-        struct tuple_concater<Ret, index_tuple<>> {
-            template <typename ...Us>
-            static constexpr Ret apply_do(Us &&...us) noexcept {
-                return Ret(forward<Us>(us)...);
+            template <typename Tps>
+            static constexpr Ret apply_do(Tps &&tps) noexcept {
+                return Ret(get<table.inner[Index]>(get_forward<
+                    table.outer[Index]>(tuple_access::impl(tps)))...);
             }
         };
+
+        template <typename Ret, size_t ...Index, typename ...Typles>
+        constexpr size_t tuple_concater<Ret, index_sequence<Index...>,
+            Typles...>::sizes[];
+
+        template <typename Ret, size_t ...Index, typename ...Typles>
+        constexpr tuple_cat_table<sizeof...(Index)> tuple_concater<Ret,
+            index_sequence<Index...>, Typles...>::table;
     }
 
     template <typename ...Typles>
     constexpr auto tuple_cat(Typles &&...args) noexcept {
         using ret_t = typename internal::tuple_cat_result<Typles ...>::type;
-        using idx_t = typename internal::make_1st_indices<Typles ...>::type;
-        using concater_t = internal::tuple_concater<ret_t, idx_t, Typles...>;
+        using concater_t = internal::tuple_concater<ret_t,
+            make_index_sequence<tuple_size<ret_t>::value>, Typles...>;
+
+        return concater_t::apply_do(
+            forward_as_tuple(forward<Typles>(args)...));
+    }
+
+    namespace internal {
+        template <typename F, typename Tuple, size_t ...Index>
+        constexpr decltype(auto)
+        apply_h(F &&f, Tuple &&tuple, index_sequence<Index...>) {
+            return forward<F>(f)(get<Index>(forward<Tuple>(tuple))...);
+        }
+
+        template <typename T, typename Tuple, size_t ...Index>
+        constexpr T
+        make_from_tuple_h(Tuple &&tuple, index_sequence<Index...>) {
+            return T(get<Index>(forward<Tuple>(tuple))...);
+        }
+    } // namespace internal
+
+    /// Call function with tuple elements as arguments
+    template <typename F, typename Tuple>
+    constexpr decltype(auto) apply(F &&f, Tuple &&tuple) {
+        return internal::apply_h(forward<F>(f), forward<Tuple>(tuple),
+            make_index_sequence<
+                tuple_size<remove_reference_t<Tuple>>::value>{});
+    }
 
-        return concater_t::apply_do(forward<Typles>(args)...);
+    /// Construct object with tuple elements as constructor arguments
+    template <typename T, typename Tuple>
+    constexpr T make_from_tuple(Tuple &&tuple) {
+        return internal::make_from_tuple_h<T>(forward<Tuple>(tuple),
+            make_index_sequence<
+                tuple_size<remove_reference_t<Tuple>>::value>{});
     }
 
     /// Swap
@@ -24,16 +24,45 @@
 #ifndef LP_CC_LIB_UTILITY_HH
 #define LP_CC_LIB_UTILITY_HH
 
+#if defined(__has_builtin) && !defined(LP_CC_LIB_NO_BUILTIN_INTEGER_SEQ)
+#if __has_builtin(__make_integer_seq)
+#define LP_CC_LIB_MAKE_INTEGER_SEQ
+#elif __has_builtin(__integer_pack)
+#define LP_CC_LIB_INTEGER_PACK
+#endif
+#endif
+
 namespace std {
     namespace internal {
         template <size_t ...Indexes>
-        struct index_tuple {
-            using next = index_tuple<Indexes..., sizeof...(Indexes)>;
+        struct index_tuple {};
+
+        /// Double index tuple - logarithmic depth of build_index_tuple
+        template <typename Indexes, bool Odd>
+        struct double_index_tuple;
+
+        template <size_t ...Indexes>
+        struct double_index_tuple<index_tuple<Indexes...>, false> {
+            using type = index_tuple<Indexes...,
+                (sizeof...(Indexes) + Indexes)...>;
+        };
+
+        template <size_t ...Indexes>
+        struct double_index_tuple<index_tuple<Indexes...>, true> {
+            using type = index_tuple<Indexes...,
+                (sizeof...(Indexes) + Indexes)...,
+                2 * sizeof...(Indexes)>;
         };
 
         template <size_t Num>
         struct build_index_tuple {
-            using type = typename build_index_tuple<Num - 1>::type::next;
+            using type = typename double_index_tuple<
+                typename build_index_tuple<Num / 2>::type, Num % 2>::type;
+        };
+
+        template <>
+        struct build_index_tuple<1> {
+            using type = index_tuple<0>;
         };
 
         template <>
@@ -67,9 +96,17 @@ namespace std {
         };
     } // namespace internal
 
+#if defined(LP_CC_LIB_MAKE_INTEGER_SEQ)
+    template<typename T, T Num>
+    using make_integer_sequence = __make_integer_seq<integer_sequence, T, Num>;
+#elif defined(LP_CC_LIB_INTEGER_PACK)
+    template<typename T, T Num>
+    using make_integer_sequence = integer_sequence<T, __integer_pack(Num)...>;
+#else
     template<typename T, T Num>
     using make_integer_sequence
         = typename internal::make_integer_sequence_h<T, Num>::type;
+#endif
 
     /// Index sequence
     template<size_t ...Index>
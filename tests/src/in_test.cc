@@ -0,0 +1,280 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Universal data input test
+ * @file in_test.cc
+ * @author Boris Vinogradov
+ */
+
+#include <in.hh>
+
+namespace {
+    template <typename T>
+    constexpr T parse(const lp::i8_t *string) {
+        const lp::i8_t *end = string;
+        while (*end != '\0') {
+            end++;
+        }
+
+        T number = 0;
+        lp::internal::number_parse::convert(string, end, number);
+
+        return number;
+    }
+
+    constexpr lp::u64_t chunked(const lp::i8_t *string) {
+        lp::u64_t number = 0;
+        lp::internal::number_parse::digits_chunked(string, string + 24, 10,
+            number);
+
+        return number;
+    }
+
+    using number_parse = lp::internal::number_parse;
+
+    constexpr lp::u64_t digits(const lp::i8_t *string, lp::u8_t base) {
+        lp::word_t count = 0;
+
+        return number_parse::word_digits(number_parse::load_word(string),
+            base, count);
+    }
+
+    constexpr lp::word_t count(const lp::i8_t *string, lp::u8_t base) {
+        lp::word_t count = 0;
+        number_parse::word_digits(number_parse::load_word(string), base,
+            count);
+
+        return count;
+    }
+
+    /// Pseudo random strings of mostly digits of base with letters,
+    /// spaces and ends of string, word and scalar loops are equal
+    template <typename T>
+    constexpr bool fuzz(lp::u32_t seed, const lp::u32_t count,
+        const lp::u8_t base) {
+        constexpr const lp::i8_t symbols[] = "0123456789abcdefABCDEFgz\x80 ";
+
+        for (lp::u32_t i = 0; i < count; i++) {
+            lp::i8_t text[32] = {};
+            seed = seed * 1664525u + 1013904223u;
+            const lp::u32_t size = (seed >> 8) % 32;
+
+            for (lp::u32_t j = 0; j < size; j++) {
+                seed = seed * 1664525u + 1013904223u;
+                const lp::u32_t pick = seed >> 8;
+
+                text[j] = pick % 64 == 0 ?
+                    symbols[(pick >> 6) % (sizeof(symbols) - 1)] :
+                    symbols[(pick >> 6) % base];
+            }
+
+            T swar = 0;
+            T scalar = 0;
+            number_parse::digits(text, text + size, base, swar);
+            number_parse::digits_scalar(text, text + size, base, scalar);
+
+            if (swar != scalar) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    using parser = lp::number_parser<T>;
+
+    template <typename T>
+    using status = typename lp::number_parser<T>::status;
+
+    constexpr lp::word_t length(const lp::i8_t *string) {
+        lp::word_t size = 0;
+        while (string[size] != '\0') {
+            size++;
+        }
+
+        return size;
+    }
+
+    /// Parse of whole string as one chunk
+    template <typename T>
+    constexpr parser<T> feed(const lp::i8_t *string) {
+        parser<T> p;
+        p.feed(string, length(string));
+
+        return p;
+    }
+
+    /// Parse symbol by symbol gives the same result as chunk
+    template <typename T>
+    constexpr bool check(const lp::i8_t *string, status<T> result,
+        T value = 0) {
+        parser<T> p;
+        for (lp::word_t i = 0; string[i] != '\0' &&
+            p.result() == status<T>::more; i++) {
+            p.push(string[i]);
+        }
+
+        const parser<T> chunk = feed<T>(string);
+
+        return p.result() == result && chunk.result() == result &&
+            (result != status<T>::done ||
+                (p.value() == value && chunk.value() == value));
+    }
+
+    /// Number at end of input is completed by finish, after symbols or
+    /// chunk
+    template <typename T>
+    constexpr bool check_finish(const lp::i8_t *string, status<T> result,
+        T value = 0) {
+        parser<T> p;
+        for (lp::word_t i = 0; string[i] != '\0'; i++) {
+            p.push(string[i]);
+        }
+
+        parser<T> chunk = feed<T>(string);
+
+        return p.finish() == result && chunk.finish() == result &&
+            p.result() == result && (result != status<T>::done ||
+                (p.value() == value && chunk.value() == value));
+    }
+
+    /// Rest of chunk after number is not consumed
+    constexpr bool check_rest() {
+        parser<lp::u32_t> p;
+        const lp::word_t used = p.feed("  12 34 ", 8);
+
+        p.reset();
+        const lp::word_t next = p.feed("  12 34 " + used, 8 - used);
+
+        return used == 5 && next == 3 && p.value() == 34;
+    }
+
+    struct null_inner {
+        static lp::i8_t recv() {
+            return '\n';
+        }
+
+        static void send(lp::i8_t) {}
+    };
+}
+
+void in_test() {
+    static_assert(parse<lp::u32_t>("0") == 0 &&
+        parse<lp::u32_t>("12345") == 12345 &&
+        parse<lp::u32_t>("4294967295") == 4294967295u &&
+        parse<lp::u32_t>("0x1F") == 31 && parse<lp::u32_t>("0xdeadbeef") ==
+        0xdeadbeef && parse<lp::u32_t>("0b101") == 5 &&
+        parse<lp::u32_t>("017") == 15 && parse<lp::u32_t>("0az") == 35, "");
+
+    static_assert(parse<lp::u32_t>("123 456") == 123 &&
+        parse<lp::u32_t>("12g4") == 12 && parse<lp::u32_t>("0b102") == 2,
+        "");
+
+    static_assert(parse<lp::u32_t>("4294967296") == 0 &&
+        parse<lp::u16_t>("65537") == 1, "");
+
+    static_assert(parse<lp::u64_t>("18446744073709551615") ==
+        18446744073709551615ull &&
+        parse<lp::u64_t>("1000000000000000000") == 1000000000000000000ull &&
+        parse<lp::u64_t>("0xfedcba9876543210") == 0xfedcba9876543210ull &&
+        parse<lp::u64_t>("0b10000000000000000000000000000000"
+            "00000000000000000000000000000001") == 0x8000000000000001ull &&
+        parse<lp::i64_t>("9223372036854775807") == 9223372036854775807ll,
+        "");
+
+    static_assert(chunked("18446744073709551615") ==
+        18446744073709551615ull && chunked("1234567890123") == 1234567890123ull,
+        "");
+
+    static_assert(digits("12345678", 10) == 12345678 &&
+        digits("00000000", 10) == 0 && digits("99999999", 10) == 99999999 &&
+        digits("1234567a", 10) == 1234567 && digits("1234 678", 10) == 1234 &&
+        digits("/1234567", 10) == 0 && digits(":1234567", 10) == 0 &&
+        count("1234 678", 10) == 4 && count("/1234567", 10) == 0, "");
+
+    static_assert(digits("deadBEEF", 16) == 0xdeadbeef &&
+        digits("01234567", 16) == 0x01234567 &&
+        digits("ffffffff", 16) == 0xffffffff &&
+        digits("89abcdeg", 16) == 0x89abcde &&
+        digits("@ABCDEF0", 16) == 0 && digits("`abcdef0", 16) == 0 &&
+        digits("F\xb0\xff" "abcde", 16) == 0xf &&
+        count("0123456\xb0", 16) == 7, "");
+
+    static_assert(parse<lp::u64_t>("1234567890123456 ") ==
+        1234567890123456ull &&
+        parse<lp::u64_t>("0x0123456789abcdef") == 0x0123456789abcdefull &&
+        parse<lp::u32_t>("123456789") == 123456789, "");
+
+    static_assert(fuzz<lp::u32_t>(1, 400, 10) &&
+        fuzz<lp::u32_t>(2, 400, 16) && fuzz<lp::u64_t>(3, 400, 10) &&
+        fuzz<lp::u64_t>(4, 400, 16) && fuzz<lp::u16_t>(5, 200, 10) &&
+        fuzz<lp::u16_t>(6, 200, 16), "");
+
+    using u32_status = status<lp::u32_t>;
+    using i8_status = status<lp::s8_t>;
+
+    static_assert(check<lp::u32_t>("0 ", u32_status::done, 0) &&
+        check<lp::u32_t>("  12345\n", u32_status::done, 12345) &&
+        check<lp::u32_t>("4294967295 ", u32_status::done, 4294967295u) &&
+        check<lp::u32_t>("0x1F ", u32_status::done, 31) &&
+        check<lp::u32_t>("0xdeadbeef\r", u32_status::done, 0xdeadbeef) &&
+        check<lp::u32_t>("0b101 ", u32_status::done, 5) &&
+        check<lp::u32_t>("017 ", u32_status::done, 15) &&
+        check<lp::u32_t>("0az ", u32_status::done, 35), "");
+
+    static_assert(check<lp::u32_t>("123", u32_status::more) &&
+        check<lp::u32_t>("", u32_status::more) &&
+        check<lp::u32_t>("0x", u32_status::more) &&
+        check<lp::u32_t>("4294967296 ", u32_status::overflow) &&
+        check<lp::u32_t>("0x100000000 ", u32_status::overflow) &&
+        check<lp::u32_t>("12g4 ", u32_status::invalid) &&
+        check<lp::u32_t>("0b102 ", u32_status::invalid) &&
+        check<lp::u32_t>("0x ", u32_status::invalid) &&
+        check<lp::u32_t>("- ", u32_status::invalid), "");
+
+    static_assert(check_finish<lp::u32_t>("123", u32_status::done, 123) &&
+        check_finish<lp::u32_t>("0", u32_status::done, 0) &&
+        check_finish<lp::u32_t>(" 0x1f", u32_status::done, 31) &&
+        check_finish<lp::u32_t>("4294967295", u32_status::done,
+            4294967295u) &&
+        check_finish<lp::u32_t>("12 ", u32_status::done, 12) &&
+        check_finish<lp::s8_t>("-128", i8_status::done, -128) &&
+        check_finish<lp::u32_t>("", u32_status::invalid) &&
+        check_finish<lp::u32_t>("  ", u32_status::invalid) &&
+        check_finish<lp::s8_t>("-", i8_status::invalid) &&
+        check_finish<lp::u32_t>("0x", u32_status::invalid) &&
+        check_finish<lp::u32_t>("12g", u32_status::invalid) &&
+        check_finish<lp::u32_t>("4294967296", u32_status::overflow), "");
+
+    static_assert(check<lp::s8_t>("-128 ", i8_status::done, -128) &&
+        check<lp::s8_t>("127 ", i8_status::done, 127) &&
+        check<lp::s8_t>("128 ", i8_status::overflow) &&
+        check<lp::s8_t>("-129 ", i8_status::overflow) &&
+        check<lp::s8_t>("-0x10 ", i8_status::done, -16), "");
+
+    static_assert(check<lp::u64_t>("18446744073709551615 ",
+        status<lp::u64_t>::done, 18446744073709551615ull) &&
+        check<lp::u64_t>("18446744073709551616 ",
+            status<lp::u64_t>::overflow) &&
+        check<lp::i64_t>("-9223372036854775808 ",
+            status<lp::i64_t>::done, -9223372036854775807ll - 1), "");
+
+    static_assert(check_rest(), "");
+
+    lp::u64_t number = 0;
+    lp::u8_t small = 0;
+    lp::in<null_inner>::recv(number, small);
+}
@@ -0,0 +1,116 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Deferred binary log test
+ * @file log_test.cc
+ * @author Boris Vinogradov
+ */
+
+#include <log.hh>
+
+#include "test_outers.hh"
+
+namespace {
+    /// Sent frame has id and raw arguments, decoder restores text of it
+    /// with record of call site as string table
+    bool check_send_decode() {
+        using namespace lp::literals;
+        using frames = record_outer<0>;
+        using text = record_outer<1>;
+        using site = lp::internal::log_site<decltype("v {} {x} {} {}{{\n"_lit),
+            lp::u16_t, lp::u32_t, lp::i32_t, const lp::i8_t *>;
+
+        lp::log<frames>::send("v {} {x} {} {}{{\n"_lit, lp::u16_t{513}, 255u,
+            -7, "ab");
+
+        const lp::i8_t expected[] = {
+            static_cast<lp::i8_t>(site::id & 0xff),
+            static_cast<lp::i8_t>(site::id >> 8 & 0xff),
+            static_cast<lp::i8_t>(site::id >> 16 & 0xff),
+            static_cast<lp::i8_t>(site::id >> 24 & 0xff),
+            1, 2, '\xff', 0, 0, 0, '\xf9', '\xff', '\xff', '\xff', 2, 'a', 'b'};
+
+        if (frames::size != sizeof(expected) ||
+            !equal(frames::data, expected, sizeof(expected))) {
+            return false;
+        }
+
+        const lp::log_decoder<text> decoder(site::record::data,
+            site::record::size());
+
+        return decoder.decode(frames::data, frames::size) == frames::size &&
+            text::size == 16 && equal(text::data, "v 513 ff -7 ab{\n", 16);
+    }
+
+    /// Two records with four bytes alignment
+    constexpr lp::i8_t table[] = {
+        1, 0, 0, 0, 'I', '\0', 'a', ' ', '{', '}', '\0', 0,
+        2, 0, 0, 0, '\0', 'b', '\0', 0,
+        1, 0, 0, 0, 'I', '\0', 'a', ' ', '{', '}', '\0', 0};
+
+    constexpr lp::i8_t collision[] = {
+        1, 0, 0, 0, '\0', 'a', '\0', 0,
+        1, 0, 0, 0, '\0', 'b', '\0', 0};
+}
+
+void log_test() {
+    using namespace lp::literals;
+
+    static_assert(lp::internal::log_format_valid("a {} b {x} {{ }}", 16) &&
+        lp::internal::log_format_valid("{o}{b}", 6) &&
+        lp::internal::log_format_valid("", 0) &&
+        !lp::internal::log_format_valid("{q}", 3) &&
+        !lp::internal::log_format_valid("{", 1) &&
+        !lp::internal::log_format_valid("a }", 3) &&
+        !lp::internal::log_format_valid("{x", 2) &&
+        !lp::internal::log_format_valid("a\0{}", 4), "");
+
+    using site = lp::internal::log_site<decltype("v {}"_lit), lp::u16_t>;
+
+    static_assert(site::frame_size == 6 && site::record::size() == 11 &&
+        equal(site::record::data + 4, "H\0v {}", 7), "");
+
+    static_assert(lp::internal::log_read<lp::u32_t>(site::record::data) ==
+        site::id, "");
+
+    static_assert(site::id != lp::internal::log_site<decltype("v {}"_lit),
+        lp::u32_t>::id, "");
+
+    using log = lp::log<block_outer>;
+
+    static_assert(log::id("v {}"_lit, lp::u16_t{1}) == site::id, "");
+
+    static_assert(lp::internal::log_frame_size<const lp::i8_t *, lp::u8_t,
+        lp::i64_t>() == 14, "");
+
+    constexpr lp::log_decoder<null_outer> decoder(table, sizeof(table));
+
+    static_assert(decoder.find(1) == table && decoder.find(2) == table + 12 &&
+        decoder.find(3) == nullptr && decoder.valid(), "");
+
+    static_assert(!lp::log_decoder<null_outer>(collision,
+        sizeof(collision)).valid(), "");
+
+    log::send("value {} {x} {} {}\n"_lit, 42u, lp::u8_t{255}, 'c', "text");
+    lp::log<null_outer>::send("value {}\n"_lit, -42ll);
+    log::flush();
+
+    const lp::i8_t frame[] = {1, 0, 0, 0, 42, 0, 0, 0};
+    decoder.decode(frame, sizeof(frame));
+}
+
+bool log_run_test() {
+    return check_send_decode();
+}
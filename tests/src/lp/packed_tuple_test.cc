@@ -0,0 +1,88 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Packed tuple test
+ * @file lp/packed_tuple_test.cc
+ * @author Boris Vinogradov
+ */
+
+#include <lp/packed_tuple.hh>
+#include <lp/types.hh>
+
+#include <tuple.hh>
+#include <type_traits.hh>
+
+struct E {};
+
+constexpr auto test_packed_set() {
+    lp::packed_tuple<lp::u8_t, lp::u32_t, lp::u16_t> t{1, 2, 3};
+
+    lp::get<0>(t) = 7;
+    lp::get<2>(t) += 10;
+
+    return lp::get<0>(t) == 7 && lp::get<1>(t) == 2 && lp::get<2>(t) == 13;
+}
+
+void packed_tuple_test() {
+    using namespace lp;
+
+    // sample: u8 flag, u32 value, u8 channel, u64 timestamp, u16 crc
+    using sample = packed_tuple<u8_t, u32_t, u8_t, u64_t, u16_t>;
+    using sample_tuple = std::tuple<u8_t, u32_t, u8_t, u64_t, u16_t>;
+
+    static_assert(sizeof(sample) ==
+        sizeof(u64_t) + sizeof(u32_t) + sizeof(u16_t) + 2 * sizeof(u8_t), "");
+
+    static_assert(sizeof(sample) < sizeof(sample_tuple), "");
+
+    static_assert(std::is_same<sample::storage_type,
+        std::tuple<u64_t, u32_t, u16_t, u8_t, u8_t>>::value, "");
+
+    // packed u8/u16 pairs: tuple wastes a byte per pair
+    using pairs = packed_tuple<u8_t, u16_t, u8_t, u16_t>;
+
+    static_assert(sizeof(pairs) == 3 * sizeof(u16_t), "");
+
+    static_assert(
+        sizeof(pairs) < sizeof(std::tuple<u8_t, u16_t, u8_t, u16_t>), "");
+
+    // already sorted types keep layout and size
+    using sorted = packed_tuple<u64_t, u32_t, u8_t>;
+
+    static_assert(
+        sizeof(sorted) == sizeof(std::tuple<u64_t, u32_t, u8_t>), "");
+
+    // empty members still take no space
+    static_assert(sizeof(packed_tuple<E, u32_t, u8_t>) ==
+        sizeof(packed_tuple<u32_t, u8_t>), "");
+
+    constexpr sample s{1, 2, 3, 4, 5};
+
+    static_assert(get<0>(s) == 1 && get<1>(s) == 2 && get<2>(s) == 3 &&
+        get<3>(s) == 4 && get<4>(s) == 5, "");
+
+    static_assert(std::is_same<sample::element<3>, u64_t>::value, "");
+
+    static_assert(std::is_same<
+        decltype(get<4>(s)), const u16_t &>::value, "");
+
+    static_assert(make_packed_tuple(u8_t{1}, 2u) ==
+        packed_tuple<u8_t, u32_t>(1, 2), "");
+
+    static_assert(make_packed_tuple(u8_t{1}, 2u) !=
+        packed_tuple<u8_t, u32_t>(1, 3), "");
+
+    static_assert(test_packed_set(), "");
+}
@@ -0,0 +1,82 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Structure of arrays test
+ * @file lp/soa_array_test.cc
+ * @author Boris Vinogradov
+ */
+
+#include <lp/soa_array.hh>
+
+#include <type_traits.hh>
+
+constexpr auto test_array_rows() {
+    lp::soa_array<4, int, char> a;
+
+    for (int i = 0; i < 4; i++) {
+        a[i] = std::make_tuple(i * 10, static_cast<char>('a' + i));
+    }
+
+    std::get<0>(a[2]) = 7;
+
+    int sum = 0;
+    for (auto value : a.column<0>()) {
+        sum += value;
+    }
+
+    return sum == 47 && a.column<1>()[3] == 'd';
+}
+
+constexpr auto test_vector() {
+    lp::soa_vector<3, int, long> v;
+
+    v.push_back(1, 2L);
+    v.push_back(3, 4);
+    v.push_back(5, 6);
+    v.pop_back();
+
+    const auto &c = v;
+
+    return v.size() == 2 && !v.empty() && !v.full() &&
+        c.column<1>().size() == 2 && c.column<1>()[1] == 4 &&
+        c[0] == std::make_tuple(1, 2L);
+}
+
+void soa_array_test() {
+    using namespace lp;
+
+    static_assert(soa_array<8, int, char>::size() == 8, "");
+
+    static_assert(soa_vector<8, int, char>::capacity == 8, "");
+
+    static_assert(std::is_same<
+        decltype(std::declval<soa_array<8, int, char> &>()[0]),
+        std::tuple<int &, char &>>::value, "");
+
+    static_assert(std::is_same<
+        decltype(std::declval<const soa_vector<8, int, char> &>()[0]),
+        std::tuple<const int &, const char &>>::value, "");
+
+    static_assert(std::is_same<
+        decltype(std::declval<soa_array<8, int, char> &>().column<1>()
+            .begin()), char *>::value, "");
+
+    static_assert(sizeof(soa_array<8, int, char>) ==
+        8 * sizeof(int) + 8 * sizeof(char), "");
+
+    static_assert(test_array_rows(), "");
+
+    static_assert(test_vector(), "");
+}
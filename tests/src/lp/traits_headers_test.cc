@@ -0,0 +1,44 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Tuple and type list traits in one translation unit test
+ * @file lp/traits_headers_test.cc
+ * @author Boris Vinogradov
+ */
+
+#include <lp/tuple_traits.hh>
+#include <lp/type_list_traits.hh>
+
+#include <type_traits.hh>
+
+namespace {
+    struct sum_functor {
+        template <typename T>
+        constexpr long operator()(long total, T value) const noexcept {
+            return total + value;
+        }
+    };
+}
+
+void traits_headers_test() {
+    using namespace lp;
+
+    static_assert(std::is_same<
+        for_each_t<std::make_unsigned, type_list<char, short>>,
+        type_list<unsigned char, unsigned short>>::value, "");
+
+    static_assert(
+        tuple_fold(std::make_tuple(1, 2L, 3), 0L, sum_functor{}) == 6, "");
+}
@@ -22,6 +22,97 @@
 
 #include <type_traits.hh>
 
+struct counter {
+    constexpr counter() noexcept
+        : copies{0}, moves{0}, value{0} {}
+
+    constexpr counter(int a, int b) noexcept
+        : copies{0}, moves{0}, value{a + b} {}
+
+    constexpr counter(const counter &other) noexcept
+        : copies{other.copies + 1}, moves{other.moves}, value{other.value} {}
+
+    constexpr counter(counter &&other) noexcept
+        : copies{other.copies}, moves{other.moves + 1}, value{other.value} {}
+
+    int copies;
+    int moves;
+    int value;
+};
+
+constexpr auto test_append_moves() {
+    counter c{};
+
+    const auto r = lp::tuple_append(
+        std::tuple<counter>{}, std::move(c), counter{});
+
+    return std::get<0>(r).copies == 0 && std::get<0>(r).moves == 1 &&
+        std::get<1>(r).copies == 0 && std::get<1>(r).moves == 1 &&
+        std::get<2>(r).copies == 0 && std::get<2>(r).moves == 1;
+}
+
+constexpr auto test_insert_copies() {
+    const std::tuple<counter> t{};
+    const counter c{};
+
+    const auto r = lp::tuple_insert(t, c);
+
+    return std::get<0>(r).copies == 1 && std::get<0>(r).moves == 0 &&
+        std::get<1>(r).copies == 1 && std::get<1>(r).moves == 0;
+}
+
+constexpr auto test_emplace_back() {
+    const auto r = lp::tuple_emplace_back<counter>(std::make_tuple(1), 2, 3);
+
+    return std::get<0>(r) == 1 && std::get<1>(r).value == 5 &&
+        std::get<1>(r).copies == 0 && std::get<1>(r).moves == 0;
+}
+
+struct accumulate {
+    template <typename T>
+    constexpr void operator () (const T &value) {
+        total = total * 10 + value;
+    }
+
+    int total;
+};
+
+/// Result with an overloaded comma operator, tuple_for_each must not
+/// pick it up
+struct trap_result {};
+
+struct trap_misuse {};
+
+template <typename T>
+constexpr trap_misuse operator , (trap_result, T) {
+    return {};
+}
+
+struct accumulate_trap {
+    template <typename T>
+    constexpr trap_result operator () (const T &value) {
+        total = total * 10 + value;
+
+        return {};
+    }
+
+    int total;
+};
+
+struct twice {
+    template <typename T>
+    constexpr auto operator () (const T &value) const {
+        return value * 2;
+    }
+};
+
+struct digits {
+    template <typename T>
+    constexpr auto operator () (long total, const T &value) const {
+        return total * 10 + value;
+    }
+};
+
 void tuple_traits_test() {
     using namespace lp;
 
@@ -40,4 +131,40 @@ void tuple_traits_test() {
     static_assert(
         tuple_insert(std::tuple<>{}, 1, 2) ==
         std::make_tuple(1, 2), "");
+
+    static_assert(
+        tuple_append(std::make_tuple(1), 2, 'a') ==
+        std::make_tuple(1, 2, 'a'), "");
+
+    static_assert(std::is_same<
+        decltype(tuple_append(std::declval<std::tuple<int &>>(),
+            std::declval<const char &>())),
+        std::tuple<int &, char>>::value, "");
+
+    static_assert(test_append_moves(), "");
+
+    static_assert(test_insert_copies(), "");
+
+    static_assert(test_emplace_back(), "");
+
+    static_assert(tuple_for_each(
+        std::make_tuple(1, 2L, '\x03'), accumulate{0}).total == 123, "");
+
+    static_assert(
+        tuple_for_each(std::tuple<>{}, accumulate{7}).total == 7, "");
+
+    static_assert(tuple_for_each(
+        std::make_tuple(4, 5), accumulate_trap{0}).total == 45, "");
+
+    static_assert(tuple_transform(
+        std::make_tuple(1, 2L), twice{}) == std::make_tuple(2, 4L), "");
+
+    static_assert(std::is_same<
+        decltype(tuple_transform(std::make_tuple(1, 2L), twice{})),
+        std::tuple<int, long>>::value, "");
+
+    static_assert(
+        tuple_fold(std::make_tuple(1, 2, '\x03'), 0L, digits{}) == 123, "");
+
+    static_assert(tuple_fold(std::tuple<>{}, 5, digits{}) == 5, "");
 }
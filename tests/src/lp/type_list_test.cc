@@ -50,6 +50,12 @@ using is_same_int = std::is_same<int, T>;
 template <typename T>
 using is_same_double = std::is_same<double, T>;
 
+template <typename T>
+using size_key = std::integral_constant<long, sizeof(T)>;
+
+template <typename T>
+using reverse_size_key = std::integral_constant<long, -long(sizeof(T))>;
+
 void type_list_test() {
     using namespace lp;
 
@@ -134,4 +140,23 @@ void type_list_test() {
     // Reverse type_list
     static_assert(std::is_same<
         int_types::reverse, type_list<long, int, short, char>>::value, "");
+
+    // Sort by key
+    static_assert(std::is_same<
+        type_list<long, char, int, short>::sort<size_key>,
+        type_list<char, short, int, long>>::value, "");
+
+    // Sort by key is stable
+    static_assert(std::is_same<
+        type_list<unsigned, char, int, signed char>::sort<size_key>,
+        type_list<char, signed char, unsigned, int>>::value, "");
+
+    // Sort by descending key
+    static_assert(std::is_same<
+        int_types::sort<reverse_size_key>,
+        type_list<long, int, short, char>>::value, "");
+
+    // Sort empty type_list
+    static_assert(std::is_same<
+        type_list<>::sort<size_key>, type_list<>>::value, "");
 }
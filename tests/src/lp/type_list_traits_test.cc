@@ -18,11 +18,123 @@
  * @author Boris Vinogradov
  */
 
+#include <lp/associate_type.hh>
+#include <lp/bit_field.hh>
 #include <lp/type_list.hh>
 #include <lp/type_list_traits.hh>
 
 #include <type_traits.hh>
 
+template <typename T>
+using position_key = std::integral_constant<lp::word_t,
+    lp::extract_type<T>::type::position>;
+
+struct reg_a {};
+
+struct reg_b {};
+
+struct size_sum {
+    template <typename T>
+    constexpr void operator () (lp::tag<T>) {
+        sum = sum * 10 + sizeof(T);
+    }
+
+    lp::word_t sum;
+};
+
+struct size_below {
+    template <typename T>
+    constexpr bool operator () (lp::tag<T>) {
+        visited++;
+
+        return sizeof(T) < limit;
+    }
+
+    lp::word_t limit;
+    lp::word_t visited;
+};
+
+struct size_of {
+    template <typename T>
+    constexpr lp::word_t operator () (lp::tag<T>) const {
+        return sizeof(T);
+    }
+};
+
+/// Result with overloaded comma and and operators, visitors must not
+/// pick them up
+struct trap_result {
+    constexpr explicit operator bool() const {
+        return true;
+    }
+};
+
+struct trap_misuse {};
+
+template <typename T>
+constexpr trap_misuse operator , (trap_result, T) {
+    return {};
+}
+
+constexpr trap_misuse operator && (bool, trap_result) {
+    return {};
+}
+
+struct count_trap {
+    template <typename T>
+    constexpr trap_result operator () (lp::tag<T>) {
+        visited++;
+
+        return {};
+    }
+
+    lp::word_t visited;
+};
+
+constexpr auto test_for_each_type_trap() {
+    count_trap functor{0};
+
+    lp::for_each_type<lp::type_list<char, short, int>>(functor);
+    const bool done =
+        lp::for_each_type_while<lp::type_list<char, short>>(functor);
+
+    return functor.visited * 10 + done;
+}
+
+constexpr auto test_dispatch(lp::word_t index) {
+    size_sum functor{0};
+
+    lp::dispatch<lp::type_list<char, short, int>>(index, functor);
+
+    return functor.sum;
+}
+
+constexpr auto test_for_each_type() {
+    size_sum functor{0};
+
+    lp::for_each_type<lp::type_list<char, short, int>>(functor);
+
+    return functor.sum;
+}
+
+constexpr auto test_for_each_type_empty() {
+    size_sum functor{0};
+
+    lp::for_each_type<lp::type_list<>>(functor);
+
+    return functor.sum;
+}
+
+constexpr auto test_for_each_type_while(lp::word_t limit) {
+    size_below functor{limit, 0};
+
+    const auto done =
+        lp::for_each_type_while<lp::type_list<char, short, int, char>>(
+            functor);
+
+    return functor.visited * 10 + done;
+}
+
 void type_list_traits_test() {
     using namespace lp;
 
@@ -68,4 +180,74 @@ void type_list_traits_test() {
         for_each_t<std::is_integral, int, void, float, double, char, bool>,
         type_list<std::true_type, std::false_type, std::false_type,
             std::false_type, std::true_type, std::true_type>>::value, "");
+
+    using fields = type_list<
+        assoc_type<bit_field<4>, reg_a>,
+        assoc_type<bit_field<0, 2>, reg_b>,
+        assoc_type<bit_field<2>, reg_a>,
+        assoc_type<bit_field<7>, reg_b>>;
+
+    static_assert(std::is_same<
+        sort_t<position_key, fields>,
+        type_list<
+            assoc_type<bit_field<0, 2>, reg_b>,
+            assoc_type<bit_field<2>, reg_a>,
+            assoc_type<bit_field<4>, reg_a>,
+            assoc_type<bit_field<7>, reg_b>>>::value, "");
+
+    static_assert(std::is_same<
+        stable_partition_t<std::is_integral, float, int, double, char>,
+        type_list<int, char, float, double>>::value, "");
+
+    static_assert(std::is_same<
+        stable_partition<std::is_integral, test_type_list>::unmatched,
+        type_list<>>::value, "");
+
+    static_assert(std::is_same<
+        group_by_assoc_t<fields>,
+        type_list<
+            type_list<
+                assoc_type<bit_field<4>, reg_a>,
+                assoc_type<bit_field<2>, reg_a>>,
+            type_list<
+                assoc_type<bit_field<0, 2>, reg_b>,
+                assoc_type<bit_field<7>, reg_b>>>>::value, "");
+
+    static_assert(std::is_same<
+        group_by_t<std::make_unsigned, int, unsigned, char, long>,
+        type_list<type_list<int, unsigned>, type_list<char>,
+            type_list<long>>>::value, "");
+
+    static_assert(test_for_each_type() == 124, "");
+
+    static_assert(test_for_each_type_empty() == 0, "");
+
+    static_assert(test_for_each_type_while(8) == 41, "");
+
+    static_assert(test_for_each_type_while(2) == 20, "");
+
+    static_assert(test_for_each_type_trap() == 51, "");
+
+    static_assert(for_each_type_while<type_list<>>(size_below{0, 0}), "");
+
+    static_assert(dispatch<test_type_list>(0, size_of{}) == 1, "");
+
+    static_assert(dispatch<test_type_list>(2, size_of{}) == 4, "");
+
+    static_assert(dispatch<test_type_list>(4, size_of{}) == 0, "");
+
+    static_assert(test_dispatch(1) == 2, "");
+
+    static_assert(test_dispatch(3) == 0, "");
+
+    using long_list = repack_t<test_type_list, test_type_list,
+        test_type_list, test_type_list, test_type_list>;
+
+    static_assert(long_list::size > dispatch_chain_limit, "");
+
+    static_assert(dispatch<long_list>(13, size_of{}) == 2, "");
+
+    static_assert(dispatch<long_list>(19, size_of{}) == sizeof(long), "");
+
+    static_assert(dispatch<long_list>(20, size_of{}) == 0, "");
 }
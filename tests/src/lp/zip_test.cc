@@ -0,0 +1,88 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Zip ranges test
+ * @file lp/zip_test.cc
+ * @author Boris Vinogradov
+ */
+
+#include <lp/zip.hh>
+#include <lp/soa_array.hh>
+
+#include <algorithm.hh>
+#include <type_traits.hh>
+
+struct by_second {
+    template <typename T>
+    constexpr bool operator () (const T &a, const T &b) const {
+        return std::get<1>(a) < std::get<1>(b);
+    }
+};
+
+constexpr auto test_zip_write() {
+    int a[3] = {1, 2, 3};
+    long b[4] = {10, 20, 30, 40};
+    int sum = 0;
+
+    for (auto row : lp::zip(a, b)) {
+        std::get<0>(row) += static_cast<int>(std::get<1>(row));
+    }
+
+    for (auto value : a) {
+        sum += value;
+    }
+
+    return sum == 66 && lp::zip(a, b).size() == 3;
+}
+
+constexpr auto test_zip_max_element() {
+    const int id[4] = {7, 8, 9, 10};
+    const int level[4] = {3, 9, 1, 9};
+    const char tag[4] = {'a', 'b', 'c', 'd'};
+
+    const auto z = lp::zip(id, level, tag);
+    const auto it = std::max_element(z.begin(), z.end(), by_second{});
+
+    return std::get<0>(*it) == 8 && std::get<2>(*it) == 'b';
+}
+
+constexpr auto test_zip_columns() {
+    lp::soa_vector<4, int, int> v;
+    int total = 0;
+
+    v.push_back(1, 2);
+    v.push_back(3, 4);
+
+    for (auto row : lp::zip(v.column<0>(), v.column<1>())) {
+        total += std::get<0>(row) * std::get<1>(row);
+    }
+
+    return total == 14;
+}
+
+void zip_test() {
+    using namespace lp;
+
+    static_assert(std::is_same<
+        decltype(*zip(std::declval<int (&)[2]>(),
+            std::declval<const char (&)[2]>()).begin()),
+        std::tuple<int &, const char &>>::value, "");
+
+    static_assert(test_zip_write(), "");
+
+    static_assert(test_zip_max_element(), "");
+
+    static_assert(test_zip_columns(), "");
+}
@@ -0,0 +1,459 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Universal data output test
+ * @file out_test.cc
+ * @author Boris Vinogradov
+ */
+
+#include <out.hh>
+
+#include "test_outers.hh"
+
+namespace {
+    constexpr bool check_dec(lp::u32_t number, const lp::i8_t *expected) {
+        lp::i8_t buffer[33] = {};
+
+        return equal(
+            lp::internal::number_format::dec(buffer + 32, number), expected);
+    }
+
+    constexpr bool check_dec_64(lp::u64_t number, const lp::i8_t *expected) {
+        lp::i8_t buffer[65] = {};
+
+        return equal(
+            lp::internal::number_format::dec(buffer + 64, number), expected);
+    }
+
+    template <lp::u8_t Shift>
+    constexpr bool check_pow2_64(lp::u64_t number,
+        const lp::i8_t *expected) {
+        lp::i8_t buffer[65] = {};
+
+        return equal(lp::internal::number_format::pow2<Shift>(
+            buffer + 64, number), expected);
+    }
+
+    template <lp::u8_t Shift>
+    constexpr bool check_pow2(lp::u32_t number, const lp::i8_t *expected) {
+        lp::i8_t buffer[33] = {};
+
+        return equal(lp::internal::number_format::pow2<Shift>(
+            buffer + 32, number), expected);
+    }
+
+    constexpr bool check_any(lp::u32_t number, lp::u8_t base,
+        const lp::i8_t *expected) {
+        lp::i8_t buffer[33] = {};
+
+        return equal(lp::internal::number_format::any(
+            buffer + 32, number, base), expected);
+    }
+
+    /// Decimal formatter matches division per digit
+    constexpr bool check_dec_range(lp::u32_t first, lp::u32_t count) {
+        for (lp::u32_t i = 0; i < count; i++) {
+            lp::i8_t a[33] = {};
+            lp::i8_t b[33] = {};
+
+            if (!equal(lp::internal::number_format::dec(a + 32, first + i),
+                lp::internal::number_format::any(b + 32, first + i, 10))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// 32 bit products quotient matches division by 10^9
+    constexpr bool check_div_1e9(lp::u64_t number) {
+        return lp::internal::div_1e9(number, std::false_type{}) ==
+            number / 1000000000;
+    }
+
+    /// Formatted args match expected string and its length
+    template <typename ...Args>
+    constexpr bool check_format(const lp::i8_t *expected,
+        const Args &...args) {
+        lp::i8_t buffer[64] = {};
+        const lp::format_result result = lp::format_to(buffer, 63, args...);
+
+        lp::word_t length = 0;
+        while (expected[length] != '\0') {
+            length++;
+        }
+
+        return result.size == length && !result.truncated &&
+            equal(buffer, expected);
+    }
+
+    /// Output over capacity is dropped
+    constexpr bool check_format_truncated() {
+        lp::i8_t buffer[8] = {};
+        lp::format_buffer output{buffer, 5};
+
+        output.send("ab", 12345u);
+        const bool full = output.size() == 5 && output.truncated() &&
+            equal(buffer, "ab123");
+
+        output.clear();
+        output.send('x');
+
+        const bool cleared = output.size() == 1 && !output.truncated() &&
+            buffer[0] == 'x' && buffer[5] == '\0';
+
+        const lp::format_result result = lp::format_to(buffer, 5, "x", 123u,
+            lp::number_base::hex, 'y');
+
+        return full && cleared && result.size == 4 && !result.truncated &&
+            lp::format_to(buffer, 3, "ab", 12345u).truncated &&
+            lp::format_to(buffer, 3, "ab", 12345u).size == 3;
+    }
+
+    /// Arrays are formatted up to the first '\0', at most size - 1
+    /// symbols
+    constexpr bool check_format_arrays() {
+        const lp::i8_t partly[16] = "partly";
+        const lp::i8_t full[4] = {'f', 'u', 'l', 'l'};
+        lp::i8_t buffer[8] = "buf";
+
+        return check_format("partly ful buf", partly, ' ', full, ' ', buffer);
+    }
+
+    /// Format string output matches expected string
+    template <typename Format, typename ...Args>
+    constexpr bool check_format_string(const lp::i8_t *expected,
+        Format format, const Args &...args) {
+        lp::i8_t buffer[64] = {};
+        lp::format_buffer output{buffer, 63};
+
+        output.format(format, args...);
+
+        return equal(buffer, expected);
+    }
+
+    template <typename Format>
+    using format_parse = lp::internal::format_parse<Format>;
+
+    /// New line sends buffer, rest waits for flush
+    bool check_flush_on_newline() {
+        using record = record_outer<0>;
+        using buffered = lp::buffered_outer<record, 16>;
+        using out = lp::out<buffered>;
+
+        record::clear();
+
+        out::send("ab\ncd");
+        const bool line = record::recorded("ab\n") &&
+            record::blocks == 1 && record::flushes == 1;
+
+        out::send('e', '\n');
+        const bool symbol_line = record::recorded("ab\ncde\n") &&
+            record::blocks == 2 && record::flushes == 2;
+
+        out::send("f");
+        out::flush();
+        const bool flushed = record::recorded("ab\ncde\nf") &&
+            record::blocks == 3 && record::flushes == 3;
+
+        out::flush();
+        const bool empty = record::blocks == 3 && record::flushes == 4;
+
+        return line && symbol_line && flushed && empty;
+    }
+
+    /// Full buffer is sent, new line does not send it
+    bool check_flush_on_full() {
+        using record = record_outer<1>;
+        using buffered = lp::buffered_outer<record, 4, lp::flush_on_full>;
+        using out = lp::out<buffered>;
+
+        record::clear();
+
+        out::send("ab\ncdefghi");
+        const bool full = record::recorded("ab\ncdefg") &&
+            record::blocks == 2 && record::flushes == 2;
+
+        out::send('j', 'k');
+        const bool symbols = record::recorded("ab\ncdefghijk") &&
+            record::blocks == 3 && record::flushes == 3;
+
+        out::send(12345u);
+        out::flush();
+        const bool flushed = record::recorded("ab\ncdefghijk12345") &&
+            record::blocks == 5 && record::flushes == 5;
+
+        return full && symbols && flushed;
+    }
+
+    /// Buffer is sent symbol by symbol to outer without block send
+    bool check_flush_symbols() {
+        using record = record_outer<2>;
+        using buffered = lp::buffered_outer<record_symbol_outer<2>, 8>;
+
+        record::clear();
+
+        lp::out<buffered>::send("line\n", 42u);
+        const bool line = record::recorded("line\n") && record::blocks == 0;
+
+        lp::out<buffered>::flush();
+
+        return line && record::recorded("line\n42") && record::blocks == 0;
+    }
+
+    /// Minimal signed numbers are negated without overflow
+    bool check_signed_min() {
+        using record = record_outer<3>;
+
+        record::clear();
+
+        lp::out<record>::send(static_cast<lp::i32_t>(-2147483647 - 1), ' ',
+            static_cast<lp::i16_t>(-32768), ' ', -9223372036854775807ll - 1,
+            ' ', lp::make_base(lp::number_base::hex,
+                static_cast<lp::i32_t>(-2147483647 - 1)));
+
+        return record::recorded(
+            "-2147483648 -32768 -9223372036854775808 -80000000");
+    }
+
+    /// Arrays are sent up to the first '\0', at most size - 1 symbols
+    bool check_arrays() {
+        using record = record_outer<4>;
+
+        const lp::i8_t partly[16] = "partly";
+        const lp::i8_t full[4] = {'f', 'u', 'l', 'l'};
+        lp::i8_t buffer[8] = "buf";
+
+        record::clear();
+
+        lp::out<record>::send(partly, '|', full, '|', buffer, '|', "text");
+
+        return record::recorded("partly|ful|buf|text");
+    }
+
+    /// Each sink gets output of its level and higher, message is sent
+    /// as one block to block outers and by symbols to others
+    bool check_fan_out_levels() {
+        using namespace lp::literals;
+        using debug = record_outer<5>;
+        using info = record_outer<6>;
+        using error = record_outer<7>;
+        using fan_out = lp::fan_out<lp::type_list<debug,
+            lp::out_sink<info, lp::out_level::info>,
+            lp::out_sink<record_symbol_outer<7>, lp::out_level::error>>>;
+
+        debug::clear();
+        info::clear();
+        error::clear();
+
+        fan_out::send<lp::out_level::debug>("d", 1, '|');
+        const bool debug_level = debug::recorded("d1|") &&
+            info::recorded("") && error::recorded("");
+
+        fan_out::send<lp::out_level::info>("i", 2u, '|');
+        const bool info_level = debug::recorded("d1|i2|") &&
+            info::recorded("i2|") && error::recorded("");
+
+        fan_out::format<lp::out_level::warning>("w{x}|"_lit, 255u);
+        const bool warning_level = debug::recorded("d1|i2|wff|") &&
+            info::recorded("i2|wff|") && error::recorded("");
+
+        fan_out::send("e", -3, '|');
+        fan_out::format("f{}\n"_lit, 4);
+        const bool error_level = debug::recorded("d1|i2|wff|e-3|f4\n") &&
+            info::recorded("i2|wff|e-3|f4\n") &&
+            error::recorded("e-3|f4\n");
+
+        fan_out::flush();
+
+        return debug_level && info_level && warning_level && error_level &&
+            debug::blocks == 5 && info::blocks == 4 && error::blocks == 0 &&
+            debug::flushes == 1 && info::flushes == 1;
+    }
+}
+
+void out_test() {
+    static_assert(check_dec(0, "0") && check_dec(7, "7") &&
+        check_dec(10, "10") && check_dec(99, "99") &&
+        check_dec(100, "100") && check_dec(12345, "12345") &&
+        check_dec(1000000000, "1000000000") &&
+        check_dec(4294967295u, "4294967295"), "");
+
+    static_assert(check_dec_range(0, 1100) &&
+        check_dec_range(4294966000u, 1295), "");
+
+    static_assert(check_pow2<4>(0, "0") &&
+        check_pow2<4>(0xdeadbeef, "deadbeef") &&
+        check_pow2<3>(8, "10") && check_pow2<3>(4294967295u, "37777777777") &&
+        check_pow2<1>(5, "101") &&
+        check_pow2<1>(0x80000000, "10000000000000000000000000000000"), "");
+
+    static_assert(check_dec_64(0, "0") &&
+        check_dec_64(4294967295ull, "4294967295") &&
+        check_dec_64(4294967296ull, "4294967296") &&
+        check_dec_64(1000000000000000000ull, "1000000000000000000") &&
+        check_dec_64(10000000000000000001ull, "10000000000000000001") &&
+        check_dec_64(18446744073709551615ull, "18446744073709551615") &&
+        check_dec_64(123456789000000007ull, "123456789000000007"), "");
+
+    static_assert(check_div_1e9(0) && check_div_1e9(999999999) &&
+        check_div_1e9(1000000000) && check_div_1e9(4294967295ull) &&
+        check_div_1e9(999999999999999999ull) &&
+        check_div_1e9(1000000000000000000ull) &&
+        check_div_1e9(18446744072999999999ull) &&
+        check_div_1e9(18446744073000000000ull) &&
+        check_div_1e9(18446744073709551615ull), "");
+
+    static_assert(check_pow2_64<4>(0xfedcba9876543210ull,
+        "fedcba9876543210") &&
+        check_pow2_64<1>(0x8000000000000000ull,
+            "1000000000000000000000000000000000000000000000000000000000000000"),
+        "");
+
+    static_assert(lp::internal::dec_count(0) == 1 &&
+        lp::internal::dec_count(9) == 1 && lp::internal::dec_count(10) == 2 &&
+        lp::internal::dec_count(99) == 2 &&
+        lp::internal::dec_count(100) == 3 &&
+        lp::internal::dec_count(999999999) == 9 &&
+        lp::internal::dec_count(1000000000) == 10 &&
+        lp::internal::dec_count(4294967295u) == 10, "");
+
+    static_assert(check_any(35, 36, "z") && check_any(36, 36, "10"), "");
+
+    static_assert(!lp::internal::has_block_send<null_outer>::value &&
+        !lp::internal::has_flush<null_outer>::value &&
+        lp::internal::has_block_send<block_outer>::value &&
+        lp::internal::has_flush<block_outer>::value, "");
+
+    static_assert(lp::internal::has_block_send<
+        lp::buffered_outer<null_outer>>::value, "");
+
+    static_assert(lp::flush_on_newline::flush_after('\n') &&
+        !lp::flush_on_newline::flush_after('a') &&
+        !lp::flush_on_full::flush_after('\n'), "");
+
+    using namespace lp::literals;
+
+    static_assert(std::is_same<decltype("ab"_lit),
+        lp::literal<'a', 'b'>>::value, "");
+
+    static_assert(std::is_same<decltype("ab"_lit + "c"_lit),
+        lp::literal<'a', 'b', 'c'>>::value, "");
+
+    static_assert(decltype("abc"_lit)::size() == 3 &&
+        equal(decltype("abc"_lit)::data, "abc"), "");
+
+    static_assert(std::is_same<decltype(LP_CC_LIB_LIT("x = {}\n")),
+        decltype("x = {}\n"_lit)>::value &&
+        std::is_same<decltype(LP_CC_LIB_LIT("")), lp::literal<>>::value &&
+        std::is_same<decltype(LP_CC_LIB_LIT("a\0b")),
+            lp::literal<'a', '\0', 'b'>>::value, "");
+
+    static_assert(decltype(LP_CC_LIB_LIT(
+        "0123456789012345678901234567890123456789012345678901234567890123"
+        "0123456789012345678901234567890123456789012345678901234567890123"
+        ))::size() == lp::internal::literal_max_size, "");
+
+    static_assert(check_format_string("x = 42\n", LP_CC_LIB_LIT("x = {}\n"),
+        42u), "");
+
+    static_assert(check_format("value 42", "value ", 42u) &&
+        check_format("-42 -2147483648", static_cast<lp::i16_t>(-42), ' ',
+            static_cast<lp::i32_t>(-2147483647 - 1)) &&
+        check_format("ff 777 101", lp::make_base(lp::number_base::hex, 255u),
+            ' ', lp::make_base(lp::number_base::oct,
+                static_cast<lp::u16_t>(511)),
+            ' ', lp::make_base(lp::number_base::bin,
+                static_cast<lp::u8_t>(5))) &&
+        check_format("18446744073709551615 -9223372036854775808",
+            18446744073709551615ull, ' ',
+            -9223372036854775807ll - 1) &&
+        check_format("ab", "a"_lit, "b"_lit) && check_format("") &&
+        check_format("2a", 42u, lp::number_base::hex) &&
+        check_format("ff 7 -101", 255u, lp::number_base::hex, ' ', 7u, ' ',
+            -5, lp::number_base::bin), "");
+
+    static_assert(check_format_truncated(), "");
+
+    static_assert(check_format_arrays(), "");
+
+    static_assert(check_format_string("x = 42, y = ff\n",
+        "x = {}, y = {x}\n"_lit, 42u, 255u) &&
+        check_format_string("{-7} 101 17", "{{{}}} {b} {o}"_lit,
+            -7, 5u, static_cast<lp::u8_t>(15)) &&
+        check_format_string("ab", "{}{}"_lit, 'a', "b") &&
+        check_format_string("text", "text"_lit), "");
+
+    static_assert(std::is_same<format_parse<decltype("a {} b{x}"_lit)>::
+        segments, lp::type_list<lp::literal<'a', ' '>, lp::literal<' ', 'b'>,
+            lp::literal<>>>::value, "");
+
+    static_assert(std::is_same<format_parse<decltype("{}{x}"_lit)>::fields,
+        lp::type_list<lp::internal::format_field<'\0'>,
+            lp::internal::format_field<'x'>>>::value, "");
+
+    static_assert(format_parse<decltype("{}}}"_lit)>::valid &&
+        !format_parse<decltype("{"_lit)>::valid &&
+        !format_parse<decltype("}"_lit)>::valid &&
+        !format_parse<decltype("{q}"_lit)>::valid, "");
+
+    using buffered_out = lp::out<
+        lp::buffered_outer<block_outer, 16, lp::flush_on_full>>;
+
+    buffered_out::send("value ", 42u, '\n');
+    buffered_out::flush();
+
+    using out = lp::out<null_outer>;
+
+    out::send("value ", 42u, ' ', -42, ' ',
+        out::make_base(out::base::hex, 255u), ' ',
+        18446744073709551615ull, ' ', -9223372036854775807ll);
+
+    lp::i8_t buffer[16] = "buffer";
+    const lp::i8_t *pointer = buffer;
+
+    out::send("a"_lit, "b"_lit, 1u, "c"_lit, buffer, pointer, "literal");
+
+    out::format("value {} of {x} in {}\n"_lit, -42, 255u, buffer);
+
+    using error_sink = lp::out_sink<null_outer, lp::out_level::error>;
+    using fan_out = lp::fan_out<lp::type_list<block_outer,
+        lp::out_sink<buffered_out::outer, lp::out_level::info>, error_sink>>;
+
+    static_assert(std::is_same<fan_out::sinks<lp::out_level::debug>,
+        lp::type_list<lp::out_sink<block_outer>>>::value &&
+        std::is_same<fan_out::sinks<lp::out_level::warning>,
+            lp::type_list<lp::out_sink<block_outer>, lp::out_sink<
+                buffered_out::outer, lp::out_level::info>>>::value &&
+        fan_out::sinks<lp::out_level::error>::size == 3, "");
+
+    static_assert(lp::fan_out<lp::type_list<error_sink>>::sinks<
+        lp::out_level::info>::size == 0, "");
+
+    fan_out::send("to every sink ", 42u, '\n');
+    fan_out::send<lp::out_level::debug>("debug ", -1, '\n');
+    fan_out::format<lp::out_level::info>("info {x}\n"_lit, 255u);
+    fan_out::format("text\n"_lit);
+    fan_out::flush();
+
+    lp::fan_out<lp::type_list<error_sink>>::send<lp::out_level::info>(
+        "dropped with formatting ", 42u);
+}
+
+bool out_run_test() {
+    return check_flush_on_newline() && check_flush_on_full() &&
+        check_flush_symbols() && check_signed_min() && check_arrays() &&
+        check_fan_out_levels();
+}
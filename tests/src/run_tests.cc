@@ -18,5 +18,11 @@
  * @author Boris Vinogradov
  */
 
+bool out_run_test();
+bool log_run_test();
+
 int main() {
+    const bool passed = out_run_test() && log_run_test();
+
+    return passed ? 0 : 1;
 }
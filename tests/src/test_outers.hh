@@ -0,0 +1,125 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Outers and compare helpers shared by tests
+ * @file test_outers.hh
+ * @author Boris Vinogradov
+ */
+
+#ifndef LP_CC_LIB_TESTS_TEST_OUTERS_HH
+#define LP_CC_LIB_TESTS_TEST_OUTERS_HH
+
+#include <lp/types.hh>
+
+namespace {
+    /// Strings are equal up to '\0'
+    constexpr bool equal(const lp::i8_t *a, const lp::i8_t *b) {
+        while (*a != '\0' && *a == *b) {
+            a++;
+            b++;
+        }
+
+        return *a == *b;
+    }
+
+    /// Symbols of size are equal, '\0' included
+    constexpr bool equal(const lp::i8_t *a, const lp::i8_t *b,
+        lp::word_t size) {
+        for (lp::word_t i = 0; i < size; i++) {
+            if (a[i] != b[i]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    struct null_outer {
+        static void send(lp::i8_t) {}
+    };
+
+    struct block_outer {
+        static void send(lp::i8_t) {}
+
+        static void send(const lp::i8_t *, lp::word_t) {}
+
+        static void flush() {}
+    };
+
+    /// Outer recording symbols, block sends and flushes, Id gives
+    /// separate records
+    template <int Id>
+    struct record_outer {
+        static void send(const lp::i8_t symbol) {
+            data[size++] = symbol;
+        }
+
+        static void send(const lp::i8_t *block, const lp::word_t count) {
+            for (lp::word_t i = 0; i < count; i++) {
+                data[size++] = block[i];
+            }
+
+            blocks++;
+        }
+
+        static void flush() {
+            flushes++;
+        }
+
+        static void clear() {
+            size = 0;
+            blocks = 0;
+            flushes = 0;
+        }
+
+        /// Recorded symbols are expected string
+        static bool recorded(const lp::i8_t *expected) {
+            for (lp::word_t i = 0; i < size; i++) {
+                if (expected[i] != data[i]) {
+                    return false;
+                }
+            }
+
+            return expected[size] == '\0';
+        }
+
+        static lp::i8_t data[256];
+        static lp::word_t size;
+        static lp::word_t blocks;
+        static lp::word_t flushes;
+    };
+
+    template <int Id>
+    lp::i8_t record_outer<Id>::data[256];
+
+    template <int Id>
+    lp::word_t record_outer<Id>::size = 0;
+
+    template <int Id>
+    lp::word_t record_outer<Id>::blocks = 0;
+
+    template <int Id>
+    lp::word_t record_outer<Id>::flushes = 0;
+
+    /// Outer recording symbols without block send
+    template <int Id>
+    struct record_symbol_outer {
+        static void send(const lp::i8_t symbol) {
+            record_outer<Id>::send(symbol);
+        }
+    };
+}
+
+#endif // LP_CC_LIB_TESTS_TEST_OUTERS_HH
@@ -27,6 +27,14 @@ struct A {
 struct B final {
 };
 
+struct D1 {
+    D1() {}
+
+    D1(const D1 &) {}
+
+    D1 & operator = (const D1 &) { return *this; }
+};
+
 constexpr auto f() {
     constexpr int x = 5;
     return std::make_tuple(x, 7);
@@ -48,6 +56,73 @@ constexpr auto test_tie_2() {
     return a == 7;
 }
 
+constexpr auto test_tie_assign() {
+    int a = 1, b = 2, c = 3, d = 4;
+
+    auto t = std::tie(a, b);
+    t = std::tie(c, d);
+
+    return a == 3 && b == 4 && &std::get<0>(t) == &a;
+}
+
+constexpr auto test_copy_assign() {
+    auto a = std::make_tuple(1, 'a');
+    const auto b = std::make_tuple(2, 'b');
+
+    a = b;
+
+    return a == b;
+}
+
+struct counter {
+    constexpr counter() noexcept
+        : copies{0}, moves{0} {}
+
+    constexpr counter(const counter &other) noexcept
+        : copies{other.copies + 1}, moves{other.moves} {}
+
+    constexpr counter(counter &&other) noexcept
+        : copies{other.copies}, moves{other.moves + 1} {}
+
+    int copies;
+    int moves;
+};
+
+constexpr auto test_tuple_cat_copies() {
+    std::tuple<counter, int> a{};
+    std::tuple<counter> b{};
+
+    const auto r = std::tuple_cat(a, b, a);
+
+    return std::get<0>(r).copies == 1 && std::get<0>(r).moves == 0 &&
+        std::get<2>(r).copies == 1 && std::get<2>(r).moves == 0 &&
+        std::get<3>(r).copies == 1 && std::get<3>(r).moves == 0;
+}
+
+constexpr auto test_tuple_cat_moves() {
+    std::tuple<counter, int> a{};
+    std::tuple<counter> b{};
+
+    const auto r = std::tuple_cat(std::move(a), std::move(b));
+
+    return std::get<0>(r).copies == 0 && std::get<0>(r).moves == 1 &&
+        std::get<2>(r).copies == 0 && std::get<2>(r).moves == 1;
+}
+
+struct sum {
+    constexpr int operator () (int a, char b, long c) const {
+        return a + b + static_cast<int>(c);
+    }
+};
+
+struct point {
+    constexpr point(int x, int y) noexcept
+        : x{x}, y{y} {}
+
+    int x;
+    int y;
+};
+
 constexpr auto test_swap() {
     auto a = std::make_tuple(1, 2);
     auto b = std::make_tuple(3, 4);
@@ -114,6 +189,12 @@ void tuple_test() {
     static_assert(get<char>(t3) == 'A' && get<int>(t3) == 10 &&
         get<double>(t3) == 5.6, "");
 
+    static_assert(get<char>(t11) == 'A' &&
+        get<char>(make_tuple(A{}, 'B')) == 'B', "");
+
+    static_assert(is_same<decltype(get<A>(declval<tuple<A, int>>())),
+        A &&>::value, "");
+
     static_assert(make_tuple(4, 8) == tuple<int, int>(4, 8), "");
 
     static_assert(make_tuple(4, 6) == make_tuple(4, 6), "");
@@ -124,6 +205,36 @@ void tuple_test() {
 
     static_assert(make_tuple(4, 1) > make_tuple(2, 9), "");
 
+    static_assert(make_tuple(-1, 5) < make_tuple(0, 0) &&
+        make_tuple(short(-3), 'a') < make_tuple(short(-3), 'b') &&
+        make_tuple(0u, -1LL) < make_tuple(0u, 1LL) &&
+        !(make_tuple(2u, 7u) < make_tuple(2u, 7u)), "");
+
+    static_assert(make_tuple(1u, 2u, 3u, 4u) < make_tuple(1u, 2u, 3u, 5u) &&
+        make_tuple(1u, 2u, 3u, 4u) == make_tuple(1u, 2u, 3u, 4u) &&
+        make_tuple(1u, 2u, 3u, 4u) != make_tuple(1u, 2u, 0u, 4u), "");
+
+    static_assert(is_same<internal::tuple_equal_for<tuple<unsigned, char>,
+        tuple<unsigned, char>>::type, internal::tuple_integral_equal<
+            tuple<unsigned, char>, index_sequence<0, 1>>>::value &&
+        is_same<internal::tuple_equal_for<tuple<int, double>,
+            tuple<int, double>>::type, internal::tuple_compare<
+                tuple<int, double>, tuple<int, double>, 0, 2>>::value &&
+        is_same<internal::tuple_equal_for<tuple<int>, tuple<long>>::type,
+            internal::tuple_compare<tuple<int>, tuple<long>, 0, 1>>::value,
+        "");
+
+    static_assert(make_tuple(-1, 'a', 1LL << 40) ==
+        make_tuple(-1, 'a', 1LL << 40) &&
+        make_tuple(-1, 'a', 1LL << 40) != make_tuple(-1, 'a', 1LL << 41) &&
+        make_tuple(-1, 'a', 0LL) != make_tuple(1, 'a', 0LL) &&
+        make_tuple(true, 0u) != make_tuple(false, 0u), "");
+
+    static_assert(make_tuple(1, 2.5) < make_tuple(1, 3.0) &&
+        make_tuple(true, 1) > make_tuple(false, 2), "");
+
+    static_assert(tuple<>{} == tuple<>{} && !(tuple<>{} < tuple<>{}), "");
+
     static_assert(test_tie(), "");
 
     static_assert(test_tie_2(), "");
@@ -134,6 +245,70 @@ void tuple_test() {
 
     static_assert(test_swap(), "");
 
+    static_assert(test_tie_assign(), "");
+
+    static_assert(test_copy_assign(), "");
+
+    static_assert(is_trivially_copyable<tuple<int, char>>::value, "");
+
+    static_assert(is_trivially_copyable<tuple<A, int, double>>::value, "");
+
+    static_assert(is_trivially_destructible<tuple<int, char>>::value, "");
+
+    static_assert(is_trivially_copy_assignable<tuple<int, A>>::value, "");
+
+    static_assert(is_trivially_move_assignable<tuple<long, B>>::value, "");
+
+    static_assert(!is_trivially_copyable<tuple<D1, int>>::value, "");
+
+    static_assert(is_copy_assignable<tuple<D1, int>>::value, "");
+
+    static_assert(is_copy_assignable<tuple<int &, int &>>::value, "");
+
+    static_assert(!is_copy_assignable<tuple<const int>>::value, "");
+
     static_assert(
         tuple_cat(t1, t2, t3) == make_tuple(0, 'A', 10, 'A', 10, 5.6), "");
+
+    static_assert(tuple_cat() == tuple<>{}, "");
+
+    static_assert(tuple_cat(t, t1, t) == t1, "");
+
+    constexpr size_t cat_sizes[] = {0, 1, 0, 2};
+    constexpr internal::tuple_cat_table<3> cat_table{cat_sizes};
+
+    static_assert(cat_table.outer[0] == 0 && cat_table.inner[0] == 0 &&
+        cat_table.outer[1] == 2 && cat_table.inner[1] == 0 &&
+        cat_table.outer[2] == 2 && cat_table.inner[2] == 1, "");
+
+    static_assert(tuple_cat(t1, tuple<>{}, make_tuple('B', 2u), t) ==
+        make_tuple(0, 'B', 2u), "");
+
+    static_assert(apply(sum{}, make_tuple(1, '\x02', 3L)) == 6, "");
+
+    static_assert(make_from_tuple<point>(make_tuple(1, 2)).y == 2, "");
+
+    static_assert(test_tuple_cat_copies(), "");
+
+    static_assert(test_tuple_cat_moves(), "");
+
+    static_assert(sizeof(tuple<A, int>) == sizeof(int), "");
+
+    static_assert(sizeof(tuple<int, A, int>) == 2 * sizeof(int), "");
+
+    static_assert(sizeof(tuple<B, int>) == 2 * sizeof(int), "");
+
+    static_assert(is_empty<tuple<A>>::value, "");
+
+    constexpr tuple<int, char, int, A, long, char, int, short> t13{
+        1, 'b', 3, A{}, 5l, 'f', 7, short{8}};
+
+    static_assert(get<6>(t13) == 7 && get<short>(t13) == 8, "");
+
+    constexpr tuple<long, long> t14{make_tuple(1, 2)};
+
+    static_assert(get<0>(t14) == 1l && get<1>(t14) == 2l, "");
+
+    static_assert(is_same<tuple_element_t<4, decltype(t13)>,
+        const long>::value, "");
 }
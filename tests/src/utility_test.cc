@@ -0,0 +1,64 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Utility test
+ * @file utility_test.cc
+ * @author Boris Vinogradov
+ */
+
+#include <initializer_list.hh>
+#include <utility.hh>
+#include <type_traits.hh>
+
+template <std::size_t ...Index>
+constexpr std::size_t sum(std::index_sequence<Index...>) {
+    std::size_t result = 0;
+    for (auto i : {std::size_t{0}, Index...}) {
+        result += i;
+    }
+
+    return result;
+}
+
+void utility_test() {
+    using namespace std;
+
+    static_assert(is_same<make_index_sequence<0>, index_sequence<>>::value, "");
+
+    static_assert(is_same<make_index_sequence<1>, index_sequence<0>>::value, "");
+
+    static_assert(is_same<make_index_sequence<6>,
+        index_sequence<0, 1, 2, 3, 4, 5>>::value, "");
+
+    static_assert(is_same<make_integer_sequence<int, 3>,
+        integer_sequence<int, 0, 1, 2>>::value, "");
+
+    static_assert(is_same<index_sequence_for<char, int, long>,
+        index_sequence<0, 1, 2>>::value, "");
+
+    static_assert(is_same<internal::build_index_tuple<7>::type,
+        internal::index_tuple<0, 1, 2, 3, 4, 5, 6>>::value, "");
+
+    static_assert(is_same<internal::make_integer_sequence_h<int, 4>::type,
+        integer_sequence<int, 0, 1, 2, 3>>::value, "");
+
+    static_assert(make_index_sequence<4096>::size() == 4096, "");
+
+    static_assert(sum(make_index_sequence<1000>{}) == 999 * 1000 / 2, "");
+
+    static_assert(
+        sum(internal::make_integer_sequence_h<size_t, 1000>::type{}) ==
+            999 * 1000 / 2, "");
+}
@@ -0,0 +1,136 @@
+/* Copyright 2018 Boris Vinogradov <no111u3@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Lepestrum C++ Library implementation
+ * Host decoder of lp::log frames
+ *
+ * String table is lp_log section of target image:
+ *   objcopy --dump-section lp_log=table.bin firmware.elf /dev/null
+ *   lp_log_decode table.bin [frames.bin] > log.txt
+ * Frames are read from stdin without frames file.
+ *
+ * @file log_decode.cc
+ * @author Boris Vinogradov
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <lp/types.hh>
+
+#include <log.hh>
+
+struct stdout_outer {
+    static void send(const lp::i8_t symbol) {
+        putchar(symbol);
+    }
+
+    static void send(const lp::i8_t *data, const lp::word_t size) {
+        fwrite(data, 1, size, stdout);
+    }
+};
+
+/// File with two '\0' after its end, they end signature and format of
+/// truncated last record of table
+static lp::i8_t *read_file(const char *name, lp::word_t &size) {
+    FILE *file = fopen(name, "rb");
+    if (file == nullptr) {
+        return nullptr;
+    }
+
+    long end = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        end = ftell(file);
+    }
+
+    if (end < 0 || fseek(file, 0, SEEK_SET) != 0) {
+        fclose(file);
+        return nullptr;
+    }
+
+    size = static_cast<lp::word_t>(end);
+
+    lp::i8_t *data = static_cast<lp::i8_t *>(malloc(size + 2));
+    if (data != nullptr && fread(data, 1, size, file) != size) {
+        free(data);
+        data = nullptr;
+    }
+
+    if (data != nullptr) {
+        data[size] = '\0';
+        data[size + 1] = '\0';
+    }
+
+    fclose(file);
+    return data;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: %s table.bin [frames.bin]\n", argv[0]);
+        return 2;
+    }
+
+    lp::word_t table_size = 0;
+    lp::i8_t *table = read_file(argv[1], table_size);
+    if (table == nullptr) {
+        fprintf(stderr, "%s: can't read string table %s\n", argv[0], argv[1]);
+        return 1;
+    }
+
+    const lp::log_decoder<stdout_outer> decoder(table, table_size);
+    if (!decoder.valid()) {
+        fprintf(stderr, "%s: string table has id collision\n", argv[0]);
+        return 1;
+    }
+
+    FILE *frames = argc == 3 ? fopen(argv[2], "rb") : stdin;
+    if (frames == nullptr) {
+        fprintf(stderr, "%s: can't read frames %s\n", argv[0], argv[2]);
+        return 1;
+    }
+
+    // Longest frame is smaller than buffer: id, 8 byte arguments, strings
+    lp::i8_t buffer[4096];
+    lp::word_t size = 0;
+    lp::word_t count = 0;
+
+    while ((count = fread(buffer + size, 1, sizeof(buffer) - size,
+        frames)) > 0) {
+        size += count;
+
+        lp::word_t at = 0;
+        lp::word_t frame = 0;
+        while ((frame = decoder.decode(buffer + at, size - at)) > 0) {
+            at += frame;
+        }
+
+        for (lp::word_t i = at; i < size; i++) {
+            buffer[i - at] = buffer[i];
+        }
+        size -= at;
+    }
+
+    if (size > 0) {
+        fprintf(stderr, "%s: incomplete frame of %zu bytes\n", argv[0],
+            static_cast<size_t>(size));
+    }
+
+    if (frames != stdin) {
+        fclose(frames);
+    }
+
+    free(table);
+    return size > 0 ? 1 : 0;
+}